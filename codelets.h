@@ -0,0 +1,2503 @@
+// Generated by gen_codelets.cpp, do not edit.
+
+// fftdif(p, 9, 3).
+inline void fftdif_9_3(T *p) {
+  uint64_t v0 = p[0].a;
+  uint64_t v1 = p[0].b;
+  uint64_t v2 = p[1].a;
+  uint64_t v3 = p[1].b;
+  uint64_t v4 = p[2].a;
+  uint64_t v5 = p[2].b;
+  uint64_t v6 = p[3].a;
+  uint64_t v7 = p[3].b;
+  uint64_t v8 = p[4].a;
+  uint64_t v9 = p[4].b;
+  uint64_t v10 = p[5].a;
+  uint64_t v11 = p[5].b;
+  uint64_t v12 = p[6].a;
+  uint64_t v13 = p[6].b;
+  uint64_t v14 = p[7].a;
+  uint64_t v15 = p[7].b;
+  uint64_t v16 = p[8].a;
+  uint64_t v17 = p[8].b;
+  uint64_t v18 = p[9].a;
+  uint64_t v19 = p[9].b;
+  uint64_t v20 = p[10].a;
+  uint64_t v21 = p[10].b;
+  uint64_t v22 = p[11].a;
+  uint64_t v23 = p[11].b;
+  uint64_t v24 = p[12].a;
+  uint64_t v25 = p[12].b;
+  uint64_t v26 = p[13].a;
+  uint64_t v27 = p[13].b;
+  uint64_t v28 = p[14].a;
+  uint64_t v29 = p[14].b;
+  uint64_t v30 = p[15].a;
+  uint64_t v31 = p[15].b;
+  uint64_t v32 = p[16].a;
+  uint64_t v33 = p[16].b;
+  uint64_t v34 = p[17].a;
+  uint64_t v35 = p[17].b;
+  uint64_t v36 = p[18].a;
+  uint64_t v37 = p[18].b;
+  uint64_t v38 = p[19].a;
+  uint64_t v39 = p[19].b;
+  uint64_t v40 = p[20].a;
+  uint64_t v41 = p[20].b;
+  uint64_t v42 = p[21].a;
+  uint64_t v43 = p[21].b;
+  uint64_t v44 = p[22].a;
+  uint64_t v45 = p[22].b;
+  uint64_t v46 = p[23].a;
+  uint64_t v47 = p[23].b;
+  uint64_t v48 = p[24].a;
+  uint64_t v49 = p[24].b;
+  uint64_t v50 = p[25].a;
+  uint64_t v51 = p[25].b;
+  uint64_t v52 = p[26].a;
+  uint64_t v53 = p[26].b;
+  uint64_t v54 = v18 + v36;
+  uint64_t v55 = v19 + v37;
+  uint64_t v56 = v19 - v37;
+  uint64_t v57 = v18 - v36;
+  uint64_t v58 = v0 + v54;
+  uint64_t v59 = v1 + v55;
+  uint64_t v60 = v0 - v56;
+  uint64_t v61 = v60 - v36;
+  uint64_t v62 = v1 + v57;
+  uint64_t v63 = v62 - v19;
+  uint64_t v64 = v0 + v56;
+  uint64_t v65 = v64 - v18;
+  uint64_t v66 = v1 - v57;
+  uint64_t v67 = v66 - v37;
+  uint64_t v68 = v20 + v38;
+  uint64_t v69 = v21 + v39;
+  uint64_t v70 = v21 - v39;
+  uint64_t v71 = v20 - v38;
+  uint64_t v72 = v2 + v68;
+  uint64_t v73 = v3 + v69;
+  uint64_t v74 = v2 - v70;
+  uint64_t v75 = v74 - v38;
+  uint64_t v76 = v3 + v71;
+  uint64_t v77 = v76 - v21;
+  uint64_t v78 = v2 + v70;
+  uint64_t v79 = v78 - v20;
+  uint64_t v80 = v3 - v71;
+  uint64_t v81 = v80 - v39;
+  uint64_t v82 = v22 + v40;
+  uint64_t v83 = v23 + v41;
+  uint64_t v84 = v23 - v41;
+  uint64_t v85 = v22 - v40;
+  uint64_t v86 = v4 + v82;
+  uint64_t v87 = v5 + v83;
+  uint64_t v88 = v4 - v84;
+  uint64_t v89 = v88 - v40;
+  uint64_t v90 = v5 + v85;
+  uint64_t v91 = v90 - v23;
+  uint64_t v92 = v4 + v84;
+  uint64_t v93 = v92 - v22;
+  uint64_t v94 = v5 - v85;
+  uint64_t v95 = v94 - v41;
+  uint64_t v96 = v24 + v42;
+  uint64_t v97 = v25 + v43;
+  uint64_t v98 = v25 - v43;
+  uint64_t v99 = v24 - v42;
+  uint64_t v100 = v6 + v96;
+  uint64_t v101 = v7 + v97;
+  uint64_t v102 = v6 - v98;
+  uint64_t v103 = v102 - v42;
+  uint64_t v104 = v7 + v99;
+  uint64_t v105 = v104 - v25;
+  uint64_t v106 = v6 + v98;
+  uint64_t v107 = v106 - v24;
+  uint64_t v108 = v7 - v99;
+  uint64_t v109 = v108 - v43;
+  uint64_t v110 = v26 + v44;
+  uint64_t v111 = v27 + v45;
+  uint64_t v112 = v27 - v45;
+  uint64_t v113 = v26 - v44;
+  uint64_t v114 = v8 + v110;
+  uint64_t v115 = v9 + v111;
+  uint64_t v116 = v8 - v112;
+  uint64_t v117 = v116 - v44;
+  uint64_t v118 = v9 + v113;
+  uint64_t v119 = v118 - v27;
+  uint64_t v120 = v8 + v112;
+  uint64_t v121 = v120 - v26;
+  uint64_t v122 = v9 - v113;
+  uint64_t v123 = v122 - v45;
+  uint64_t v124 = v28 + v46;
+  uint64_t v125 = v29 + v47;
+  uint64_t v126 = v29 - v47;
+  uint64_t v127 = v28 - v46;
+  uint64_t v128 = v10 + v124;
+  uint64_t v129 = v11 + v125;
+  uint64_t v130 = v10 - v126;
+  uint64_t v131 = v130 - v46;
+  uint64_t v132 = v11 + v127;
+  uint64_t v133 = v132 - v29;
+  uint64_t v134 = v10 + v126;
+  uint64_t v135 = v134 - v28;
+  uint64_t v136 = v11 - v127;
+  uint64_t v137 = v136 - v47;
+  uint64_t v138 = v30 + v48;
+  uint64_t v139 = v31 + v49;
+  uint64_t v140 = v31 - v49;
+  uint64_t v141 = v30 - v48;
+  uint64_t v142 = v12 + v138;
+  uint64_t v143 = v13 + v139;
+  uint64_t v144 = v12 - v140;
+  uint64_t v145 = v144 - v48;
+  uint64_t v146 = v13 + v141;
+  uint64_t v147 = v146 - v31;
+  uint64_t v148 = v12 + v140;
+  uint64_t v149 = v148 - v30;
+  uint64_t v150 = v13 - v141;
+  uint64_t v151 = v150 - v49;
+  uint64_t v152 = v32 + v50;
+  uint64_t v153 = v33 + v51;
+  uint64_t v154 = v33 - v51;
+  uint64_t v155 = v32 - v50;
+  uint64_t v156 = v14 + v152;
+  uint64_t v157 = v15 + v153;
+  uint64_t v158 = v14 - v154;
+  uint64_t v159 = v158 - v50;
+  uint64_t v160 = v15 + v155;
+  uint64_t v161 = v160 - v33;
+  uint64_t v162 = v14 + v154;
+  uint64_t v163 = v162 - v32;
+  uint64_t v164 = v15 - v155;
+  uint64_t v165 = v164 - v51;
+  uint64_t v166 = v34 + v52;
+  uint64_t v167 = v35 + v53;
+  uint64_t v168 = v35 - v53;
+  uint64_t v169 = v34 - v52;
+  uint64_t v170 = v16 + v166;
+  uint64_t v171 = v17 + v167;
+  uint64_t v172 = v16 - v168;
+  uint64_t v173 = v172 - v52;
+  uint64_t v174 = v17 + v169;
+  uint64_t v175 = v174 - v35;
+  uint64_t v176 = v16 + v168;
+  uint64_t v177 = v176 - v34;
+  uint64_t v178 = v17 - v169;
+  uint64_t v179 = v178 - v53;
+  p[0] = T(v58, v59);
+  p[1] = T(v72, v73);
+  p[2] = T(v86, v87);
+  p[3] = T(v100, v101);
+  p[4] = T(v114, v115);
+  p[5] = T(v128, v129);
+  p[6] = T(v142, v143);
+  p[7] = T(v156, v157);
+  p[8] = T(v170, v171);
+  p[9] = T(v61, v63);
+  p[10] = T(v75, v77);
+  p[11] = T(v89, v91);
+  p[12] = T(v103, v105);
+  p[13] = T(v117, v119);
+  p[14] = T(v131, v133);
+  p[15] = T(v145, v147);
+  p[16] = T(v159, v161);
+  p[17] = T(v173, v175);
+  p[18] = T(v65, v67);
+  p[19] = T(v79, v81);
+  p[20] = T(v93, v95);
+  p[21] = T(v107, v109);
+  p[22] = T(v121, v123);
+  p[23] = T(v135, v137);
+  p[24] = T(v149, v151);
+  p[25] = T(v163, v165);
+  p[26] = T(v177, v179);
+}
+
+// fftdit(p, 9, 3).
+inline void fftdit_9_3(T *p) {
+  uint64_t v0 = p[0].a;
+  uint64_t v1 = p[0].b;
+  uint64_t v2 = p[1].a;
+  uint64_t v3 = p[1].b;
+  uint64_t v4 = p[2].a;
+  uint64_t v5 = p[2].b;
+  uint64_t v6 = p[3].a;
+  uint64_t v7 = p[3].b;
+  uint64_t v8 = p[4].a;
+  uint64_t v9 = p[4].b;
+  uint64_t v10 = p[5].a;
+  uint64_t v11 = p[5].b;
+  uint64_t v12 = p[6].a;
+  uint64_t v13 = p[6].b;
+  uint64_t v14 = p[7].a;
+  uint64_t v15 = p[7].b;
+  uint64_t v16 = p[8].a;
+  uint64_t v17 = p[8].b;
+  uint64_t v18 = p[9].a;
+  uint64_t v19 = p[9].b;
+  uint64_t v20 = p[10].a;
+  uint64_t v21 = p[10].b;
+  uint64_t v22 = p[11].a;
+  uint64_t v23 = p[11].b;
+  uint64_t v24 = p[12].a;
+  uint64_t v25 = p[12].b;
+  uint64_t v26 = p[13].a;
+  uint64_t v27 = p[13].b;
+  uint64_t v28 = p[14].a;
+  uint64_t v29 = p[14].b;
+  uint64_t v30 = p[15].a;
+  uint64_t v31 = p[15].b;
+  uint64_t v32 = p[16].a;
+  uint64_t v33 = p[16].b;
+  uint64_t v34 = p[17].a;
+  uint64_t v35 = p[17].b;
+  uint64_t v36 = p[18].a;
+  uint64_t v37 = p[18].b;
+  uint64_t v38 = p[19].a;
+  uint64_t v39 = p[19].b;
+  uint64_t v40 = p[20].a;
+  uint64_t v41 = p[20].b;
+  uint64_t v42 = p[21].a;
+  uint64_t v43 = p[21].b;
+  uint64_t v44 = p[22].a;
+  uint64_t v45 = p[22].b;
+  uint64_t v46 = p[23].a;
+  uint64_t v47 = p[23].b;
+  uint64_t v48 = p[24].a;
+  uint64_t v49 = p[24].b;
+  uint64_t v50 = p[25].a;
+  uint64_t v51 = p[25].b;
+  uint64_t v52 = p[26].a;
+  uint64_t v53 = p[26].b;
+  uint64_t v54 = v18 + v36;
+  uint64_t v55 = v19 + v37;
+  uint64_t v56 = v19 - v37;
+  uint64_t v57 = v18 - v36;
+  uint64_t v58 = v0 + v54;
+  uint64_t v59 = v1 + v55;
+  uint64_t v60 = v0 - v56;
+  uint64_t v61 = v60 - v36;
+  uint64_t v62 = v1 + v57;
+  uint64_t v63 = v62 - v19;
+  uint64_t v64 = v0 + v56;
+  uint64_t v65 = v64 - v18;
+  uint64_t v66 = v1 - v57;
+  uint64_t v67 = v66 - v37;
+  uint64_t v68 = v20 + v38;
+  uint64_t v69 = v21 + v39;
+  uint64_t v70 = v21 - v39;
+  uint64_t v71 = v20 - v38;
+  uint64_t v72 = v2 + v68;
+  uint64_t v73 = v3 + v69;
+  uint64_t v74 = v2 - v70;
+  uint64_t v75 = v74 - v38;
+  uint64_t v76 = v3 + v71;
+  uint64_t v77 = v76 - v21;
+  uint64_t v78 = v2 + v70;
+  uint64_t v79 = v78 - v20;
+  uint64_t v80 = v3 - v71;
+  uint64_t v81 = v80 - v39;
+  uint64_t v82 = v22 + v40;
+  uint64_t v83 = v23 + v41;
+  uint64_t v84 = v23 - v41;
+  uint64_t v85 = v22 - v40;
+  uint64_t v86 = v4 + v82;
+  uint64_t v87 = v5 + v83;
+  uint64_t v88 = v4 - v84;
+  uint64_t v89 = v88 - v40;
+  uint64_t v90 = v5 + v85;
+  uint64_t v91 = v90 - v23;
+  uint64_t v92 = v4 + v84;
+  uint64_t v93 = v92 - v22;
+  uint64_t v94 = v5 - v85;
+  uint64_t v95 = v94 - v41;
+  uint64_t v96 = v24 + v42;
+  uint64_t v97 = v25 + v43;
+  uint64_t v98 = v25 - v43;
+  uint64_t v99 = v24 - v42;
+  uint64_t v100 = v6 + v96;
+  uint64_t v101 = v7 + v97;
+  uint64_t v102 = v6 - v98;
+  uint64_t v103 = v102 - v42;
+  uint64_t v104 = v7 + v99;
+  uint64_t v105 = v104 - v25;
+  uint64_t v106 = v6 + v98;
+  uint64_t v107 = v106 - v24;
+  uint64_t v108 = v7 - v99;
+  uint64_t v109 = v108 - v43;
+  uint64_t v110 = v26 + v44;
+  uint64_t v111 = v27 + v45;
+  uint64_t v112 = v27 - v45;
+  uint64_t v113 = v26 - v44;
+  uint64_t v114 = v8 + v110;
+  uint64_t v115 = v9 + v111;
+  uint64_t v116 = v8 - v112;
+  uint64_t v117 = v116 - v44;
+  uint64_t v118 = v9 + v113;
+  uint64_t v119 = v118 - v27;
+  uint64_t v120 = v8 + v112;
+  uint64_t v121 = v120 - v26;
+  uint64_t v122 = v9 - v113;
+  uint64_t v123 = v122 - v45;
+  uint64_t v124 = v28 + v46;
+  uint64_t v125 = v29 + v47;
+  uint64_t v126 = v29 - v47;
+  uint64_t v127 = v28 - v46;
+  uint64_t v128 = v10 + v124;
+  uint64_t v129 = v11 + v125;
+  uint64_t v130 = v10 - v126;
+  uint64_t v131 = v130 - v46;
+  uint64_t v132 = v11 + v127;
+  uint64_t v133 = v132 - v29;
+  uint64_t v134 = v10 + v126;
+  uint64_t v135 = v134 - v28;
+  uint64_t v136 = v11 - v127;
+  uint64_t v137 = v136 - v47;
+  uint64_t v138 = v30 + v48;
+  uint64_t v139 = v31 + v49;
+  uint64_t v140 = v31 - v49;
+  uint64_t v141 = v30 - v48;
+  uint64_t v142 = v12 + v138;
+  uint64_t v143 = v13 + v139;
+  uint64_t v144 = v12 - v140;
+  uint64_t v145 = v144 - v48;
+  uint64_t v146 = v13 + v141;
+  uint64_t v147 = v146 - v31;
+  uint64_t v148 = v12 + v140;
+  uint64_t v149 = v148 - v30;
+  uint64_t v150 = v13 - v141;
+  uint64_t v151 = v150 - v49;
+  uint64_t v152 = v32 + v50;
+  uint64_t v153 = v33 + v51;
+  uint64_t v154 = v33 - v51;
+  uint64_t v155 = v32 - v50;
+  uint64_t v156 = v14 + v152;
+  uint64_t v157 = v15 + v153;
+  uint64_t v158 = v14 - v154;
+  uint64_t v159 = v158 - v50;
+  uint64_t v160 = v15 + v155;
+  uint64_t v161 = v160 - v33;
+  uint64_t v162 = v14 + v154;
+  uint64_t v163 = v162 - v32;
+  uint64_t v164 = v15 - v155;
+  uint64_t v165 = v164 - v51;
+  uint64_t v166 = v34 + v52;
+  uint64_t v167 = v35 + v53;
+  uint64_t v168 = v35 - v53;
+  uint64_t v169 = v34 - v52;
+  uint64_t v170 = v16 + v166;
+  uint64_t v171 = v17 + v167;
+  uint64_t v172 = v16 - v168;
+  uint64_t v173 = v172 - v52;
+  uint64_t v174 = v17 + v169;
+  uint64_t v175 = v174 - v35;
+  uint64_t v176 = v16 + v168;
+  uint64_t v177 = v176 - v34;
+  uint64_t v178 = v17 - v169;
+  uint64_t v179 = v178 - v53;
+  p[0] = T(v58, v59);
+  p[1] = T(v72, v73);
+  p[2] = T(v86, v87);
+  p[3] = T(v100, v101);
+  p[4] = T(v114, v115);
+  p[5] = T(v128, v129);
+  p[6] = T(v142, v143);
+  p[7] = T(v156, v157);
+  p[8] = T(v170, v171);
+  p[9] = T(v65, v67);
+  p[10] = T(v79, v81);
+  p[11] = T(v93, v95);
+  p[12] = T(v107, v109);
+  p[13] = T(v121, v123);
+  p[14] = T(v135, v137);
+  p[15] = T(v149, v151);
+  p[16] = T(v163, v165);
+  p[17] = T(v177, v179);
+  p[18] = T(v61, v63);
+  p[19] = T(v75, v77);
+  p[20] = T(v89, v91);
+  p[21] = T(v103, v105);
+  p[22] = T(v117, v119);
+  p[23] = T(v131, v133);
+  p[24] = T(v145, v147);
+  p[25] = T(v159, v161);
+  p[26] = T(v173, v175);
+}
+
+// fftdif(p, 9, 9).
+inline void fftdif_9_9(T *p) {
+  uint64_t v0 = p[0].a;
+  uint64_t v1 = p[0].b;
+  uint64_t v2 = p[1].a;
+  uint64_t v3 = p[1].b;
+  uint64_t v4 = p[2].a;
+  uint64_t v5 = p[2].b;
+  uint64_t v6 = p[3].a;
+  uint64_t v7 = p[3].b;
+  uint64_t v8 = p[4].a;
+  uint64_t v9 = p[4].b;
+  uint64_t v10 = p[5].a;
+  uint64_t v11 = p[5].b;
+  uint64_t v12 = p[6].a;
+  uint64_t v13 = p[6].b;
+  uint64_t v14 = p[7].a;
+  uint64_t v15 = p[7].b;
+  uint64_t v16 = p[8].a;
+  uint64_t v17 = p[8].b;
+  uint64_t v18 = p[9].a;
+  uint64_t v19 = p[9].b;
+  uint64_t v20 = p[10].a;
+  uint64_t v21 = p[10].b;
+  uint64_t v22 = p[11].a;
+  uint64_t v23 = p[11].b;
+  uint64_t v24 = p[12].a;
+  uint64_t v25 = p[12].b;
+  uint64_t v26 = p[13].a;
+  uint64_t v27 = p[13].b;
+  uint64_t v28 = p[14].a;
+  uint64_t v29 = p[14].b;
+  uint64_t v30 = p[15].a;
+  uint64_t v31 = p[15].b;
+  uint64_t v32 = p[16].a;
+  uint64_t v33 = p[16].b;
+  uint64_t v34 = p[17].a;
+  uint64_t v35 = p[17].b;
+  uint64_t v36 = p[18].a;
+  uint64_t v37 = p[18].b;
+  uint64_t v38 = p[19].a;
+  uint64_t v39 = p[19].b;
+  uint64_t v40 = p[20].a;
+  uint64_t v41 = p[20].b;
+  uint64_t v42 = p[21].a;
+  uint64_t v43 = p[21].b;
+  uint64_t v44 = p[22].a;
+  uint64_t v45 = p[22].b;
+  uint64_t v46 = p[23].a;
+  uint64_t v47 = p[23].b;
+  uint64_t v48 = p[24].a;
+  uint64_t v49 = p[24].b;
+  uint64_t v50 = p[25].a;
+  uint64_t v51 = p[25].b;
+  uint64_t v52 = p[26].a;
+  uint64_t v53 = p[26].b;
+  uint64_t v54 = p[27].a;
+  uint64_t v55 = p[27].b;
+  uint64_t v56 = p[28].a;
+  uint64_t v57 = p[28].b;
+  uint64_t v58 = p[29].a;
+  uint64_t v59 = p[29].b;
+  uint64_t v60 = p[30].a;
+  uint64_t v61 = p[30].b;
+  uint64_t v62 = p[31].a;
+  uint64_t v63 = p[31].b;
+  uint64_t v64 = p[32].a;
+  uint64_t v65 = p[32].b;
+  uint64_t v66 = p[33].a;
+  uint64_t v67 = p[33].b;
+  uint64_t v68 = p[34].a;
+  uint64_t v69 = p[34].b;
+  uint64_t v70 = p[35].a;
+  uint64_t v71 = p[35].b;
+  uint64_t v72 = p[36].a;
+  uint64_t v73 = p[36].b;
+  uint64_t v74 = p[37].a;
+  uint64_t v75 = p[37].b;
+  uint64_t v76 = p[38].a;
+  uint64_t v77 = p[38].b;
+  uint64_t v78 = p[39].a;
+  uint64_t v79 = p[39].b;
+  uint64_t v80 = p[40].a;
+  uint64_t v81 = p[40].b;
+  uint64_t v82 = p[41].a;
+  uint64_t v83 = p[41].b;
+  uint64_t v84 = p[42].a;
+  uint64_t v85 = p[42].b;
+  uint64_t v86 = p[43].a;
+  uint64_t v87 = p[43].b;
+  uint64_t v88 = p[44].a;
+  uint64_t v89 = p[44].b;
+  uint64_t v90 = p[45].a;
+  uint64_t v91 = p[45].b;
+  uint64_t v92 = p[46].a;
+  uint64_t v93 = p[46].b;
+  uint64_t v94 = p[47].a;
+  uint64_t v95 = p[47].b;
+  uint64_t v96 = p[48].a;
+  uint64_t v97 = p[48].b;
+  uint64_t v98 = p[49].a;
+  uint64_t v99 = p[49].b;
+  uint64_t v100 = p[50].a;
+  uint64_t v101 = p[50].b;
+  uint64_t v102 = p[51].a;
+  uint64_t v103 = p[51].b;
+  uint64_t v104 = p[52].a;
+  uint64_t v105 = p[52].b;
+  uint64_t v106 = p[53].a;
+  uint64_t v107 = p[53].b;
+  uint64_t v108 = p[54].a;
+  uint64_t v109 = p[54].b;
+  uint64_t v110 = p[55].a;
+  uint64_t v111 = p[55].b;
+  uint64_t v112 = p[56].a;
+  uint64_t v113 = p[56].b;
+  uint64_t v114 = p[57].a;
+  uint64_t v115 = p[57].b;
+  uint64_t v116 = p[58].a;
+  uint64_t v117 = p[58].b;
+  uint64_t v118 = p[59].a;
+  uint64_t v119 = p[59].b;
+  uint64_t v120 = p[60].a;
+  uint64_t v121 = p[60].b;
+  uint64_t v122 = p[61].a;
+  uint64_t v123 = p[61].b;
+  uint64_t v124 = p[62].a;
+  uint64_t v125 = p[62].b;
+  uint64_t v126 = p[63].a;
+  uint64_t v127 = p[63].b;
+  uint64_t v128 = p[64].a;
+  uint64_t v129 = p[64].b;
+  uint64_t v130 = p[65].a;
+  uint64_t v131 = p[65].b;
+  uint64_t v132 = p[66].a;
+  uint64_t v133 = p[66].b;
+  uint64_t v134 = p[67].a;
+  uint64_t v135 = p[67].b;
+  uint64_t v136 = p[68].a;
+  uint64_t v137 = p[68].b;
+  uint64_t v138 = p[69].a;
+  uint64_t v139 = p[69].b;
+  uint64_t v140 = p[70].a;
+  uint64_t v141 = p[70].b;
+  uint64_t v142 = p[71].a;
+  uint64_t v143 = p[71].b;
+  uint64_t v144 = p[72].a;
+  uint64_t v145 = p[72].b;
+  uint64_t v146 = p[73].a;
+  uint64_t v147 = p[73].b;
+  uint64_t v148 = p[74].a;
+  uint64_t v149 = p[74].b;
+  uint64_t v150 = p[75].a;
+  uint64_t v151 = p[75].b;
+  uint64_t v152 = p[76].a;
+  uint64_t v153 = p[76].b;
+  uint64_t v154 = p[77].a;
+  uint64_t v155 = p[77].b;
+  uint64_t v156 = p[78].a;
+  uint64_t v157 = p[78].b;
+  uint64_t v158 = p[79].a;
+  uint64_t v159 = p[79].b;
+  uint64_t v160 = p[80].a;
+  uint64_t v161 = p[80].b;
+  uint64_t v162 = v54 + v108;
+  uint64_t v163 = v55 + v109;
+  uint64_t v164 = v55 - v109;
+  uint64_t v165 = v54 - v108;
+  uint64_t v166 = v0 + v162;
+  uint64_t v167 = v1 + v163;
+  uint64_t v168 = v0 - v164;
+  uint64_t v169 = v168 - v108;
+  uint64_t v170 = v1 + v165;
+  uint64_t v171 = v170 - v55;
+  uint64_t v172 = v0 + v164;
+  uint64_t v173 = v172 - v54;
+  uint64_t v174 = v1 - v165;
+  uint64_t v175 = v174 - v109;
+  uint64_t v176 = v56 + v110;
+  uint64_t v177 = v57 + v111;
+  uint64_t v178 = v57 - v111;
+  uint64_t v179 = v56 - v110;
+  uint64_t v180 = v2 + v176;
+  uint64_t v181 = v3 + v177;
+  uint64_t v182 = v2 - v178;
+  uint64_t v183 = v182 - v110;
+  uint64_t v184 = v3 + v179;
+  uint64_t v185 = v184 - v57;
+  uint64_t v186 = v2 + v178;
+  uint64_t v187 = v186 - v56;
+  uint64_t v188 = v3 - v179;
+  uint64_t v189 = v188 - v111;
+  uint64_t v190 = v58 + v112;
+  uint64_t v191 = v59 + v113;
+  uint64_t v192 = v59 - v113;
+  uint64_t v193 = v58 - v112;
+  uint64_t v194 = v4 + v190;
+  uint64_t v195 = v5 + v191;
+  uint64_t v196 = v4 - v192;
+  uint64_t v197 = v196 - v112;
+  uint64_t v198 = v5 + v193;
+  uint64_t v199 = v198 - v59;
+  uint64_t v200 = v4 + v192;
+  uint64_t v201 = v200 - v58;
+  uint64_t v202 = v5 - v193;
+  uint64_t v203 = v202 - v113;
+  uint64_t v204 = v60 + v114;
+  uint64_t v205 = v61 + v115;
+  uint64_t v206 = v61 - v115;
+  uint64_t v207 = v60 - v114;
+  uint64_t v208 = v6 + v204;
+  uint64_t v209 = v7 + v205;
+  uint64_t v210 = v6 - v206;
+  uint64_t v211 = v210 - v114;
+  uint64_t v212 = v7 + v207;
+  uint64_t v213 = v212 - v61;
+  uint64_t v214 = v6 + v206;
+  uint64_t v215 = v214 - v60;
+  uint64_t v216 = v7 - v207;
+  uint64_t v217 = v216 - v115;
+  uint64_t v218 = v62 + v116;
+  uint64_t v219 = v63 + v117;
+  uint64_t v220 = v63 - v117;
+  uint64_t v221 = v62 - v116;
+  uint64_t v222 = v8 + v218;
+  uint64_t v223 = v9 + v219;
+  uint64_t v224 = v8 - v220;
+  uint64_t v225 = v224 - v116;
+  uint64_t v226 = v9 + v221;
+  uint64_t v227 = v226 - v63;
+  uint64_t v228 = v8 + v220;
+  uint64_t v229 = v228 - v62;
+  uint64_t v230 = v9 - v221;
+  uint64_t v231 = v230 - v117;
+  uint64_t v232 = v64 + v118;
+  uint64_t v233 = v65 + v119;
+  uint64_t v234 = v65 - v119;
+  uint64_t v235 = v64 - v118;
+  uint64_t v236 = v10 + v232;
+  uint64_t v237 = v11 + v233;
+  uint64_t v238 = v10 - v234;
+  uint64_t v239 = v238 - v118;
+  uint64_t v240 = v11 + v235;
+  uint64_t v241 = v240 - v65;
+  uint64_t v242 = v10 + v234;
+  uint64_t v243 = v242 - v64;
+  uint64_t v244 = v11 - v235;
+  uint64_t v245 = v244 - v119;
+  uint64_t v246 = v66 + v120;
+  uint64_t v247 = v67 + v121;
+  uint64_t v248 = v67 - v121;
+  uint64_t v249 = v66 - v120;
+  uint64_t v250 = v12 + v246;
+  uint64_t v251 = v13 + v247;
+  uint64_t v252 = v12 - v248;
+  uint64_t v253 = v252 - v120;
+  uint64_t v254 = v13 + v249;
+  uint64_t v255 = v254 - v67;
+  uint64_t v256 = v12 + v248;
+  uint64_t v257 = v256 - v66;
+  uint64_t v258 = v13 - v249;
+  uint64_t v259 = v258 - v121;
+  uint64_t v260 = v68 + v122;
+  uint64_t v261 = v69 + v123;
+  uint64_t v262 = v69 - v123;
+  uint64_t v263 = v68 - v122;
+  uint64_t v264 = v14 + v260;
+  uint64_t v265 = v15 + v261;
+  uint64_t v266 = v14 - v262;
+  uint64_t v267 = v266 - v122;
+  uint64_t v268 = v15 + v263;
+  uint64_t v269 = v268 - v69;
+  uint64_t v270 = v14 + v262;
+  uint64_t v271 = v270 - v68;
+  uint64_t v272 = v15 - v263;
+  uint64_t v273 = v272 - v123;
+  uint64_t v274 = v70 + v124;
+  uint64_t v275 = v71 + v125;
+  uint64_t v276 = v71 - v125;
+  uint64_t v277 = v70 - v124;
+  uint64_t v278 = v16 + v274;
+  uint64_t v279 = v17 + v275;
+  uint64_t v280 = v16 - v276;
+  uint64_t v281 = v280 - v124;
+  uint64_t v282 = v17 + v277;
+  uint64_t v283 = v282 - v71;
+  uint64_t v284 = v16 + v276;
+  uint64_t v285 = v284 - v70;
+  uint64_t v286 = v17 - v277;
+  uint64_t v287 = v286 - v125;
+  uint64_t v288 = v72 + v126;
+  uint64_t v289 = v73 + v127;
+  uint64_t v290 = v73 - v127;
+  uint64_t v291 = v72 - v126;
+  uint64_t v292 = v18 + v288;
+  uint64_t v293 = v19 + v289;
+  uint64_t v294 = v18 - v290;
+  uint64_t v295 = v294 - v126;
+  uint64_t v296 = v19 + v291;
+  uint64_t v297 = v296 - v73;
+  uint64_t v298 = v18 + v290;
+  uint64_t v299 = v298 - v72;
+  uint64_t v300 = v19 - v291;
+  uint64_t v301 = v300 - v127;
+  uint64_t v302 = v74 + v128;
+  uint64_t v303 = v75 + v129;
+  uint64_t v304 = v75 - v129;
+  uint64_t v305 = v74 - v128;
+  uint64_t v306 = v20 + v302;
+  uint64_t v307 = v21 + v303;
+  uint64_t v308 = v20 - v304;
+  uint64_t v309 = v308 - v128;
+  uint64_t v310 = v21 + v305;
+  uint64_t v311 = v310 - v75;
+  uint64_t v312 = v20 + v304;
+  uint64_t v313 = v312 - v74;
+  uint64_t v314 = v21 - v305;
+  uint64_t v315 = v314 - v129;
+  uint64_t v316 = v76 + v130;
+  uint64_t v317 = v77 + v131;
+  uint64_t v318 = v77 - v131;
+  uint64_t v319 = v76 - v130;
+  uint64_t v320 = v22 + v316;
+  uint64_t v321 = v23 + v317;
+  uint64_t v322 = v22 - v318;
+  uint64_t v323 = v322 - v130;
+  uint64_t v324 = v23 + v319;
+  uint64_t v325 = v324 - v77;
+  uint64_t v326 = v22 + v318;
+  uint64_t v327 = v326 - v76;
+  uint64_t v328 = v23 - v319;
+  uint64_t v329 = v328 - v131;
+  uint64_t v330 = v78 + v132;
+  uint64_t v331 = v79 + v133;
+  uint64_t v332 = v79 - v133;
+  uint64_t v333 = v78 - v132;
+  uint64_t v334 = v24 + v330;
+  uint64_t v335 = v25 + v331;
+  uint64_t v336 = v24 - v332;
+  uint64_t v337 = v336 - v132;
+  uint64_t v338 = v25 + v333;
+  uint64_t v339 = v338 - v79;
+  uint64_t v340 = v24 + v332;
+  uint64_t v341 = v340 - v78;
+  uint64_t v342 = v25 - v333;
+  uint64_t v343 = v342 - v133;
+  uint64_t v344 = v80 + v134;
+  uint64_t v345 = v81 + v135;
+  uint64_t v346 = v81 - v135;
+  uint64_t v347 = v80 - v134;
+  uint64_t v348 = v26 + v344;
+  uint64_t v349 = v27 + v345;
+  uint64_t v350 = v26 - v346;
+  uint64_t v351 = v350 - v134;
+  uint64_t v352 = v27 + v347;
+  uint64_t v353 = v352 - v81;
+  uint64_t v354 = v26 + v346;
+  uint64_t v355 = v354 - v80;
+  uint64_t v356 = v27 - v347;
+  uint64_t v357 = v356 - v135;
+  uint64_t v358 = v82 + v136;
+  uint64_t v359 = v83 + v137;
+  uint64_t v360 = v83 - v137;
+  uint64_t v361 = v82 - v136;
+  uint64_t v362 = v28 + v358;
+  uint64_t v363 = v29 + v359;
+  uint64_t v364 = v28 - v360;
+  uint64_t v365 = v364 - v136;
+  uint64_t v366 = v29 + v361;
+  uint64_t v367 = v366 - v83;
+  uint64_t v368 = v28 + v360;
+  uint64_t v369 = v368 - v82;
+  uint64_t v370 = v29 - v361;
+  uint64_t v371 = v370 - v137;
+  uint64_t v372 = v84 + v138;
+  uint64_t v373 = v85 + v139;
+  uint64_t v374 = v85 - v139;
+  uint64_t v375 = v84 - v138;
+  uint64_t v376 = v30 + v372;
+  uint64_t v377 = v31 + v373;
+  uint64_t v378 = v30 - v374;
+  uint64_t v379 = v378 - v138;
+  uint64_t v380 = v31 + v375;
+  uint64_t v381 = v380 - v85;
+  uint64_t v382 = v30 + v374;
+  uint64_t v383 = v382 - v84;
+  uint64_t v384 = v31 - v375;
+  uint64_t v385 = v384 - v139;
+  uint64_t v386 = v86 + v140;
+  uint64_t v387 = v87 + v141;
+  uint64_t v388 = v87 - v141;
+  uint64_t v389 = v86 - v140;
+  uint64_t v390 = v32 + v386;
+  uint64_t v391 = v33 + v387;
+  uint64_t v392 = v32 - v388;
+  uint64_t v393 = v392 - v140;
+  uint64_t v394 = v33 + v389;
+  uint64_t v395 = v394 - v87;
+  uint64_t v396 = v32 + v388;
+  uint64_t v397 = v396 - v86;
+  uint64_t v398 = v33 - v389;
+  uint64_t v399 = v398 - v141;
+  uint64_t v400 = v88 + v142;
+  uint64_t v401 = v89 + v143;
+  uint64_t v402 = v89 - v143;
+  uint64_t v403 = v88 - v142;
+  uint64_t v404 = v34 + v400;
+  uint64_t v405 = v35 + v401;
+  uint64_t v406 = v34 - v402;
+  uint64_t v407 = v406 - v142;
+  uint64_t v408 = v35 + v403;
+  uint64_t v409 = v408 - v89;
+  uint64_t v410 = v34 + v402;
+  uint64_t v411 = v410 - v88;
+  uint64_t v412 = v35 - v403;
+  uint64_t v413 = v412 - v143;
+  uint64_t v414 = v379 - v381;
+  uint64_t v415 = v393 - v395;
+  uint64_t v416 = v407 - v409;
+  uint64_t v417 = v341 - v343;
+  uint64_t v418 = v355 - v357;
+  uint64_t v419 = v369 - v371;
+  uint64_t v420 = v383 - v385;
+  uint64_t v421 = v397 - v399;
+  uint64_t v422 = v411 - v413;
+  uint64_t v423 = v90 + v144;
+  uint64_t v424 = v91 + v145;
+  uint64_t v425 = v91 - v145;
+  uint64_t v426 = v90 - v144;
+  uint64_t v427 = v36 + v423;
+  uint64_t v428 = v37 + v424;
+  uint64_t v429 = v36 - v425;
+  uint64_t v430 = v429 - v144;
+  uint64_t v431 = v37 + v426;
+  uint64_t v432 = v431 - v91;
+  uint64_t v433 = v36 + v425;
+  uint64_t v434 = v433 - v90;
+  uint64_t v435 = v37 - v426;
+  uint64_t v436 = v435 - v145;
+  uint64_t v437 = v92 + v146;
+  uint64_t v438 = v93 + v147;
+  uint64_t v439 = v93 - v147;
+  uint64_t v440 = v92 - v146;
+  uint64_t v441 = v38 + v437;
+  uint64_t v442 = v39 + v438;
+  uint64_t v443 = v38 - v439;
+  uint64_t v444 = v443 - v146;
+  uint64_t v445 = v39 + v440;
+  uint64_t v446 = v445 - v93;
+  uint64_t v447 = v38 + v439;
+  uint64_t v448 = v447 - v92;
+  uint64_t v449 = v39 - v440;
+  uint64_t v450 = v449 - v147;
+  uint64_t v451 = v94 + v148;
+  uint64_t v452 = v95 + v149;
+  uint64_t v453 = v95 - v149;
+  uint64_t v454 = v94 - v148;
+  uint64_t v455 = v40 + v451;
+  uint64_t v456 = v41 + v452;
+  uint64_t v457 = v40 - v453;
+  uint64_t v458 = v457 - v148;
+  uint64_t v459 = v41 + v454;
+  uint64_t v460 = v459 - v95;
+  uint64_t v461 = v40 + v453;
+  uint64_t v462 = v461 - v94;
+  uint64_t v463 = v41 - v454;
+  uint64_t v464 = v463 - v149;
+  uint64_t v465 = v96 + v150;
+  uint64_t v466 = v97 + v151;
+  uint64_t v467 = v97 - v151;
+  uint64_t v468 = v96 - v150;
+  uint64_t v469 = v42 + v465;
+  uint64_t v470 = v43 + v466;
+  uint64_t v471 = v42 - v467;
+  uint64_t v472 = v471 - v150;
+  uint64_t v473 = v43 + v468;
+  uint64_t v474 = v473 - v97;
+  uint64_t v475 = v42 + v467;
+  uint64_t v476 = v475 - v96;
+  uint64_t v477 = v43 - v468;
+  uint64_t v478 = v477 - v151;
+  uint64_t v479 = v98 + v152;
+  uint64_t v480 = v99 + v153;
+  uint64_t v481 = v99 - v153;
+  uint64_t v482 = v98 - v152;
+  uint64_t v483 = v44 + v479;
+  uint64_t v484 = v45 + v480;
+  uint64_t v485 = v44 - v481;
+  uint64_t v486 = v485 - v152;
+  uint64_t v487 = v45 + v482;
+  uint64_t v488 = v487 - v99;
+  uint64_t v489 = v44 + v481;
+  uint64_t v490 = v489 - v98;
+  uint64_t v491 = v45 - v482;
+  uint64_t v492 = v491 - v153;
+  uint64_t v493 = v100 + v154;
+  uint64_t v494 = v101 + v155;
+  uint64_t v495 = v101 - v155;
+  uint64_t v496 = v100 - v154;
+  uint64_t v497 = v46 + v493;
+  uint64_t v498 = v47 + v494;
+  uint64_t v499 = v46 - v495;
+  uint64_t v500 = v499 - v154;
+  uint64_t v501 = v47 + v496;
+  uint64_t v502 = v501 - v101;
+  uint64_t v503 = v46 + v495;
+  uint64_t v504 = v503 - v100;
+  uint64_t v505 = v47 - v496;
+  uint64_t v506 = v505 - v155;
+  uint64_t v507 = v102 + v156;
+  uint64_t v508 = v103 + v157;
+  uint64_t v509 = v103 - v157;
+  uint64_t v510 = v102 - v156;
+  uint64_t v511 = v48 + v507;
+  uint64_t v512 = v49 + v508;
+  uint64_t v513 = v48 - v509;
+  uint64_t v514 = v513 - v156;
+  uint64_t v515 = v49 + v510;
+  uint64_t v516 = v515 - v103;
+  uint64_t v517 = v48 + v509;
+  uint64_t v518 = v517 - v102;
+  uint64_t v519 = v49 - v510;
+  uint64_t v520 = v519 - v157;
+  uint64_t v521 = v104 + v158;
+  uint64_t v522 = v105 + v159;
+  uint64_t v523 = v105 - v159;
+  uint64_t v524 = v104 - v158;
+  uint64_t v525 = v50 + v521;
+  uint64_t v526 = v51 + v522;
+  uint64_t v527 = v50 - v523;
+  uint64_t v528 = v527 - v158;
+  uint64_t v529 = v51 + v524;
+  uint64_t v530 = v529 - v105;
+  uint64_t v531 = v50 + v523;
+  uint64_t v532 = v531 - v104;
+  uint64_t v533 = v51 - v524;
+  uint64_t v534 = v533 - v159;
+  uint64_t v535 = v106 + v160;
+  uint64_t v536 = v107 + v161;
+  uint64_t v537 = v107 - v161;
+  uint64_t v538 = v106 - v160;
+  uint64_t v539 = v52 + v535;
+  uint64_t v540 = v53 + v536;
+  uint64_t v541 = v52 - v537;
+  uint64_t v542 = v541 - v160;
+  uint64_t v543 = v53 + v538;
+  uint64_t v544 = v543 - v107;
+  uint64_t v545 = v52 + v537;
+  uint64_t v546 = v545 - v106;
+  uint64_t v547 = v53 - v538;
+  uint64_t v548 = v547 - v161;
+  uint64_t v549 = v472 - v474;
+  uint64_t v550 = v486 - v488;
+  uint64_t v551 = v500 - v502;
+  uint64_t v552 = v514 - v516;
+  uint64_t v553 = v528 - v530;
+  uint64_t v554 = v542 - v544;
+  uint64_t v555 = v434 - v436;
+  uint64_t v556 = v448 - v450;
+  uint64_t v557 = v462 - v464;
+  uint64_t v558 = v476 - v478;
+  uint64_t v559 = v490 - v492;
+  uint64_t v560 = v504 - v506;
+  uint64_t v561 = v520 - v518;
+  uint64_t v562 = v534 - v532;
+  uint64_t v563 = v548 - v546;
+  uint64_t v564 = v292 + v427;
+  uint64_t v565 = v293 + v428;
+  uint64_t v566 = v293 - v428;
+  uint64_t v567 = v292 - v427;
+  uint64_t v568 = v166 + v564;
+  uint64_t v569 = v167 + v565;
+  uint64_t v570 = v166 - v566;
+  uint64_t v571 = v570 - v427;
+  uint64_t v572 = v167 + v567;
+  uint64_t v573 = v572 - v293;
+  uint64_t v574 = v166 + v566;
+  uint64_t v575 = v574 - v292;
+  uint64_t v576 = v167 - v567;
+  uint64_t v577 = v576 - v428;
+  uint64_t v578 = v306 + v441;
+  uint64_t v579 = v307 + v442;
+  uint64_t v580 = v307 - v442;
+  uint64_t v581 = v306 - v441;
+  uint64_t v582 = v180 + v578;
+  uint64_t v583 = v181 + v579;
+  uint64_t v584 = v180 - v580;
+  uint64_t v585 = v584 - v441;
+  uint64_t v586 = v181 + v581;
+  uint64_t v587 = v586 - v307;
+  uint64_t v588 = v180 + v580;
+  uint64_t v589 = v588 - v306;
+  uint64_t v590 = v181 - v581;
+  uint64_t v591 = v590 - v442;
+  uint64_t v592 = v320 + v455;
+  uint64_t v593 = v321 + v456;
+  uint64_t v594 = v321 - v456;
+  uint64_t v595 = v320 - v455;
+  uint64_t v596 = v194 + v592;
+  uint64_t v597 = v195 + v593;
+  uint64_t v598 = v194 - v594;
+  uint64_t v599 = v598 - v455;
+  uint64_t v600 = v195 + v595;
+  uint64_t v601 = v600 - v321;
+  uint64_t v602 = v194 + v594;
+  uint64_t v603 = v602 - v320;
+  uint64_t v604 = v195 - v595;
+  uint64_t v605 = v604 - v456;
+  uint64_t v606 = v334 + v469;
+  uint64_t v607 = v335 + v470;
+  uint64_t v608 = v335 - v470;
+  uint64_t v609 = v334 - v469;
+  uint64_t v610 = v208 + v606;
+  uint64_t v611 = v209 + v607;
+  uint64_t v612 = v208 - v608;
+  uint64_t v613 = v612 - v469;
+  uint64_t v614 = v209 + v609;
+  uint64_t v615 = v614 - v335;
+  uint64_t v616 = v208 + v608;
+  uint64_t v617 = v616 - v334;
+  uint64_t v618 = v209 - v609;
+  uint64_t v619 = v618 - v470;
+  uint64_t v620 = v348 + v483;
+  uint64_t v621 = v349 + v484;
+  uint64_t v622 = v349 - v484;
+  uint64_t v623 = v348 - v483;
+  uint64_t v624 = v222 + v620;
+  uint64_t v625 = v223 + v621;
+  uint64_t v626 = v222 - v622;
+  uint64_t v627 = v626 - v483;
+  uint64_t v628 = v223 + v623;
+  uint64_t v629 = v628 - v349;
+  uint64_t v630 = v222 + v622;
+  uint64_t v631 = v630 - v348;
+  uint64_t v632 = v223 - v623;
+  uint64_t v633 = v632 - v484;
+  uint64_t v634 = v362 + v497;
+  uint64_t v635 = v363 + v498;
+  uint64_t v636 = v363 - v498;
+  uint64_t v637 = v362 - v497;
+  uint64_t v638 = v236 + v634;
+  uint64_t v639 = v237 + v635;
+  uint64_t v640 = v236 - v636;
+  uint64_t v641 = v640 - v497;
+  uint64_t v642 = v237 + v637;
+  uint64_t v643 = v642 - v363;
+  uint64_t v644 = v236 + v636;
+  uint64_t v645 = v644 - v362;
+  uint64_t v646 = v237 - v637;
+  uint64_t v647 = v646 - v498;
+  uint64_t v648 = v376 + v511;
+  uint64_t v649 = v377 + v512;
+  uint64_t v650 = v377 - v512;
+  uint64_t v651 = v376 - v511;
+  uint64_t v652 = v250 + v648;
+  uint64_t v653 = v251 + v649;
+  uint64_t v654 = v250 - v650;
+  uint64_t v655 = v654 - v511;
+  uint64_t v656 = v251 + v651;
+  uint64_t v657 = v656 - v377;
+  uint64_t v658 = v250 + v650;
+  uint64_t v659 = v658 - v376;
+  uint64_t v660 = v251 - v651;
+  uint64_t v661 = v660 - v512;
+  uint64_t v662 = v390 + v525;
+  uint64_t v663 = v391 + v526;
+  uint64_t v664 = v391 - v526;
+  uint64_t v665 = v390 - v525;
+  uint64_t v666 = v264 + v662;
+  uint64_t v667 = v265 + v663;
+  uint64_t v668 = v264 - v664;
+  uint64_t v669 = v668 - v525;
+  uint64_t v670 = v265 + v665;
+  uint64_t v671 = v670 - v391;
+  uint64_t v672 = v264 + v664;
+  uint64_t v673 = v672 - v390;
+  uint64_t v674 = v265 - v665;
+  uint64_t v675 = v674 - v526;
+  uint64_t v676 = v404 + v539;
+  uint64_t v677 = v405 + v540;
+  uint64_t v678 = v405 - v540;
+  uint64_t v679 = v404 - v539;
+  uint64_t v680 = v278 + v676;
+  uint64_t v681 = v279 + v677;
+  uint64_t v682 = v278 - v678;
+  uint64_t v683 = v682 - v539;
+  uint64_t v684 = v279 + v679;
+  uint64_t v685 = v684 - v405;
+  uint64_t v686 = v278 + v678;
+  uint64_t v687 = v686 - v404;
+  uint64_t v688 = v279 - v679;
+  uint64_t v689 = v688 - v540;
+  uint64_t v690 = v381 + v474;
+  uint64_t v691 = v414 + v549;
+  uint64_t v692 = v414 - v549;
+  uint64_t v693 = v474 - v381;
+  uint64_t v694 = v169 - v690;
+  uint64_t v695 = v171 + v691;
+  uint64_t v696 = v169 - v692;
+  uint64_t v697 = v696 + v474;
+  uint64_t v698 = v171 + v693;
+  uint64_t v699 = v698 - v414;
+  uint64_t v700 = v169 + v692;
+  uint64_t v701 = v700 + v381;
+  uint64_t v702 = v171 - v693;
+  uint64_t v703 = v702 - v549;
+  uint64_t v704 = v395 + v488;
+  uint64_t v705 = v415 + v550;
+  uint64_t v706 = v415 - v550;
+  uint64_t v707 = v488 - v395;
+  uint64_t v708 = v183 - v704;
+  uint64_t v709 = v185 + v705;
+  uint64_t v710 = v183 - v706;
+  uint64_t v711 = v710 + v488;
+  uint64_t v712 = v185 + v707;
+  uint64_t v713 = v712 - v415;
+  uint64_t v714 = v183 + v706;
+  uint64_t v715 = v714 + v395;
+  uint64_t v716 = v185 - v707;
+  uint64_t v717 = v716 - v550;
+  uint64_t v718 = v409 + v502;
+  uint64_t v719 = v416 + v551;
+  uint64_t v720 = v416 - v551;
+  uint64_t v721 = v502 - v409;
+  uint64_t v722 = v197 - v718;
+  uint64_t v723 = v199 + v719;
+  uint64_t v724 = v197 - v720;
+  uint64_t v725 = v724 + v502;
+  uint64_t v726 = v199 + v721;
+  uint64_t v727 = v726 - v416;
+  uint64_t v728 = v197 + v720;
+  uint64_t v729 = v728 + v409;
+  uint64_t v730 = v199 - v721;
+  uint64_t v731 = v730 - v551;
+  uint64_t v732 = v295 - v516;
+  uint64_t v733 = v297 + v552;
+  uint64_t v734 = v297 - v552;
+  uint64_t v735 = v295 + v516;
+  uint64_t v736 = v211 + v732;
+  uint64_t v737 = v213 + v733;
+  uint64_t v738 = v211 - v734;
+  uint64_t v739 = v738 + v516;
+  uint64_t v740 = v213 + v735;
+  uint64_t v741 = v740 - v297;
+  uint64_t v742 = v211 + v734;
+  uint64_t v743 = v742 - v295;
+  uint64_t v744 = v213 - v735;
+  uint64_t v745 = v744 - v552;
+  uint64_t v746 = v309 - v530;
+  uint64_t v747 = v311 + v553;
+  uint64_t v748 = v311 - v553;
+  uint64_t v749 = v309 + v530;
+  uint64_t v750 = v225 + v746;
+  uint64_t v751 = v227 + v747;
+  uint64_t v752 = v225 - v748;
+  uint64_t v753 = v752 + v530;
+  uint64_t v754 = v227 + v749;
+  uint64_t v755 = v754 - v311;
+  uint64_t v756 = v225 + v748;
+  uint64_t v757 = v756 - v309;
+  uint64_t v758 = v227 - v749;
+  uint64_t v759 = v758 - v553;
+  uint64_t v760 = v323 - v544;
+  uint64_t v761 = v325 + v554;
+  uint64_t v762 = v325 - v554;
+  uint64_t v763 = v323 + v544;
+  uint64_t v764 = v239 + v760;
+  uint64_t v765 = v241 + v761;
+  uint64_t v766 = v239 - v762;
+  uint64_t v767 = v766 + v544;
+  uint64_t v768 = v241 + v763;
+  uint64_t v769 = v768 - v325;
+  uint64_t v770 = v239 + v762;
+  uint64_t v771 = v770 - v323;
+  uint64_t v772 = v241 - v763;
+  uint64_t v773 = v772 - v554;
+  uint64_t v774 = v337 + v430;
+  uint64_t v775 = v339 + v432;
+  uint64_t v776 = v339 - v432;
+  uint64_t v777 = v337 - v430;
+  uint64_t v778 = v253 + v774;
+  uint64_t v779 = v255 + v775;
+  uint64_t v780 = v253 - v776;
+  uint64_t v781 = v780 - v430;
+  uint64_t v782 = v255 + v777;
+  uint64_t v783 = v782 - v339;
+  uint64_t v784 = v253 + v776;
+  uint64_t v785 = v784 - v337;
+  uint64_t v786 = v255 - v777;
+  uint64_t v787 = v786 - v432;
+  uint64_t v788 = v351 + v444;
+  uint64_t v789 = v353 + v446;
+  uint64_t v790 = v353 - v446;
+  uint64_t v791 = v351 - v444;
+  uint64_t v792 = v267 + v788;
+  uint64_t v793 = v269 + v789;
+  uint64_t v794 = v267 - v790;
+  uint64_t v795 = v794 - v444;
+  uint64_t v796 = v269 + v791;
+  uint64_t v797 = v796 - v353;
+  uint64_t v798 = v267 + v790;
+  uint64_t v799 = v798 - v351;
+  uint64_t v800 = v269 - v791;
+  uint64_t v801 = v800 - v446;
+  uint64_t v802 = v365 + v458;
+  uint64_t v803 = v367 + v460;
+  uint64_t v804 = v367 - v460;
+  uint64_t v805 = v365 - v458;
+  uint64_t v806 = v281 + v802;
+  uint64_t v807 = v283 + v803;
+  uint64_t v808 = v281 - v804;
+  uint64_t v809 = v808 - v458;
+  uint64_t v810 = v283 + v805;
+  uint64_t v811 = v810 - v367;
+  uint64_t v812 = v281 + v804;
+  uint64_t v813 = v812 - v365;
+  uint64_t v814 = v283 - v805;
+  uint64_t v815 = v814 - v460;
+  uint64_t v816 = v561 - v343;
+  uint64_t v817 = v417 - v518;
+  uint64_t v818 = v417 + v518;
+  uint64_t v819 = v343 + v561;
+  uint64_t v820 = v173 + v816;
+  uint64_t v821 = v175 + v817;
+  uint64_t v822 = v173 - v818;
+  uint64_t v823 = v822 - v561;
+  uint64_t v824 = v175 - v819;
+  uint64_t v825 = v824 - v417;
+  uint64_t v826 = v173 + v818;
+  uint64_t v827 = v826 + v343;
+  uint64_t v828 = v175 + v819;
+  uint64_t v829 = v828 + v518;
+  uint64_t v830 = v562 - v357;
+  uint64_t v831 = v418 - v532;
+  uint64_t v832 = v418 + v532;
+  uint64_t v833 = v357 + v562;
+  uint64_t v834 = v187 + v830;
+  uint64_t v835 = v189 + v831;
+  uint64_t v836 = v187 - v832;
+  uint64_t v837 = v836 - v562;
+  uint64_t v838 = v189 - v833;
+  uint64_t v839 = v838 - v418;
+  uint64_t v840 = v187 + v832;
+  uint64_t v841 = v840 + v357;
+  uint64_t v842 = v189 + v833;
+  uint64_t v843 = v842 + v532;
+  uint64_t v844 = v563 - v371;
+  uint64_t v845 = v419 - v546;
+  uint64_t v846 = v419 + v546;
+  uint64_t v847 = v371 + v563;
+  uint64_t v848 = v201 + v844;
+  uint64_t v849 = v203 + v845;
+  uint64_t v850 = v201 - v846;
+  uint64_t v851 = v850 - v563;
+  uint64_t v852 = v203 - v847;
+  uint64_t v853 = v852 - v419;
+  uint64_t v854 = v201 + v846;
+  uint64_t v855 = v854 + v371;
+  uint64_t v856 = v203 + v847;
+  uint64_t v857 = v856 + v546;
+  uint64_t v858 = v385 + v436;
+  uint64_t v859 = v420 + v555;
+  uint64_t v860 = v420 - v555;
+  uint64_t v861 = v436 - v385;
+  uint64_t v862 = v215 - v858;
+  uint64_t v863 = v217 + v859;
+  uint64_t v864 = v215 - v860;
+  uint64_t v865 = v864 + v436;
+  uint64_t v866 = v217 + v861;
+  uint64_t v867 = v866 - v420;
+  uint64_t v868 = v215 + v860;
+  uint64_t v869 = v868 + v385;
+  uint64_t v870 = v217 - v861;
+  uint64_t v871 = v870 - v555;
+  uint64_t v872 = v399 + v450;
+  uint64_t v873 = v421 + v556;
+  uint64_t v874 = v421 - v556;
+  uint64_t v875 = v450 - v399;
+  uint64_t v876 = v229 - v872;
+  uint64_t v877 = v231 + v873;
+  uint64_t v878 = v229 - v874;
+  uint64_t v879 = v878 + v450;
+  uint64_t v880 = v231 + v875;
+  uint64_t v881 = v880 - v421;
+  uint64_t v882 = v229 + v874;
+  uint64_t v883 = v882 + v399;
+  uint64_t v884 = v231 - v875;
+  uint64_t v885 = v884 - v556;
+  uint64_t v886 = v413 + v464;
+  uint64_t v887 = v422 + v557;
+  uint64_t v888 = v422 - v557;
+  uint64_t v889 = v464 - v413;
+  uint64_t v890 = v243 - v886;
+  uint64_t v891 = v245 + v887;
+  uint64_t v892 = v243 - v888;
+  uint64_t v893 = v892 + v464;
+  uint64_t v894 = v245 + v889;
+  uint64_t v895 = v894 - v422;
+  uint64_t v896 = v243 + v888;
+  uint64_t v897 = v896 + v413;
+  uint64_t v898 = v245 - v889;
+  uint64_t v899 = v898 - v557;
+  uint64_t v900 = v299 - v478;
+  uint64_t v901 = v301 + v558;
+  uint64_t v902 = v301 - v558;
+  uint64_t v903 = v299 + v478;
+  uint64_t v904 = v257 + v900;
+  uint64_t v905 = v259 + v901;
+  uint64_t v906 = v257 - v902;
+  uint64_t v907 = v906 + v478;
+  uint64_t v908 = v259 + v903;
+  uint64_t v909 = v908 - v301;
+  uint64_t v910 = v257 + v902;
+  uint64_t v911 = v910 - v299;
+  uint64_t v912 = v259 - v903;
+  uint64_t v913 = v912 - v558;
+  uint64_t v914 = v313 - v492;
+  uint64_t v915 = v315 + v559;
+  uint64_t v916 = v315 - v559;
+  uint64_t v917 = v313 + v492;
+  uint64_t v918 = v271 + v914;
+  uint64_t v919 = v273 + v915;
+  uint64_t v920 = v271 - v916;
+  uint64_t v921 = v920 + v492;
+  uint64_t v922 = v273 + v917;
+  uint64_t v923 = v922 - v315;
+  uint64_t v924 = v271 + v916;
+  uint64_t v925 = v924 - v313;
+  uint64_t v926 = v273 - v917;
+  uint64_t v927 = v926 - v559;
+  uint64_t v928 = v327 - v506;
+  uint64_t v929 = v329 + v560;
+  uint64_t v930 = v329 - v560;
+  uint64_t v931 = v327 + v506;
+  uint64_t v932 = v285 + v928;
+  uint64_t v933 = v287 + v929;
+  uint64_t v934 = v285 - v930;
+  uint64_t v935 = v934 + v506;
+  uint64_t v936 = v287 + v931;
+  uint64_t v937 = v936 - v329;
+  uint64_t v938 = v285 + v930;
+  uint64_t v939 = v938 - v327;
+  uint64_t v940 = v287 - v931;
+  uint64_t v941 = v940 - v560;
+  p[0] = T(v568, v569);
+  p[1] = T(v582, v583);
+  p[2] = T(v596, v597);
+  p[3] = T(v610, v611);
+  p[4] = T(v624, v625);
+  p[5] = T(v638, v639);
+  p[6] = T(v652, v653);
+  p[7] = T(v666, v667);
+  p[8] = T(v680, v681);
+  p[9] = T(v571, v573);
+  p[10] = T(v585, v587);
+  p[11] = T(v599, v601);
+  p[12] = T(v613, v615);
+  p[13] = T(v627, v629);
+  p[14] = T(v641, v643);
+  p[15] = T(v655, v657);
+  p[16] = T(v669, v671);
+  p[17] = T(v683, v685);
+  p[18] = T(v575, v577);
+  p[19] = T(v589, v591);
+  p[20] = T(v603, v605);
+  p[21] = T(v617, v619);
+  p[22] = T(v631, v633);
+  p[23] = T(v645, v647);
+  p[24] = T(v659, v661);
+  p[25] = T(v673, v675);
+  p[26] = T(v687, v689);
+  p[27] = T(v694, v695);
+  p[28] = T(v708, v709);
+  p[29] = T(v722, v723);
+  p[30] = T(v736, v737);
+  p[31] = T(v750, v751);
+  p[32] = T(v764, v765);
+  p[33] = T(v778, v779);
+  p[34] = T(v792, v793);
+  p[35] = T(v806, v807);
+  p[36] = T(v697, v699);
+  p[37] = T(v711, v713);
+  p[38] = T(v725, v727);
+  p[39] = T(v739, v741);
+  p[40] = T(v753, v755);
+  p[41] = T(v767, v769);
+  p[42] = T(v781, v783);
+  p[43] = T(v795, v797);
+  p[44] = T(v809, v811);
+  p[45] = T(v701, v703);
+  p[46] = T(v715, v717);
+  p[47] = T(v729, v731);
+  p[48] = T(v743, v745);
+  p[49] = T(v757, v759);
+  p[50] = T(v771, v773);
+  p[51] = T(v785, v787);
+  p[52] = T(v799, v801);
+  p[53] = T(v813, v815);
+  p[54] = T(v820, v821);
+  p[55] = T(v834, v835);
+  p[56] = T(v848, v849);
+  p[57] = T(v862, v863);
+  p[58] = T(v876, v877);
+  p[59] = T(v890, v891);
+  p[60] = T(v904, v905);
+  p[61] = T(v918, v919);
+  p[62] = T(v932, v933);
+  p[63] = T(v823, v825);
+  p[64] = T(v837, v839);
+  p[65] = T(v851, v853);
+  p[66] = T(v865, v867);
+  p[67] = T(v879, v881);
+  p[68] = T(v893, v895);
+  p[69] = T(v907, v909);
+  p[70] = T(v921, v923);
+  p[71] = T(v935, v937);
+  p[72] = T(v827, v829);
+  p[73] = T(v841, v843);
+  p[74] = T(v855, v857);
+  p[75] = T(v869, v871);
+  p[76] = T(v883, v885);
+  p[77] = T(v897, v899);
+  p[78] = T(v911, v913);
+  p[79] = T(v925, v927);
+  p[80] = T(v939, v941);
+}
+
+// fftdit(p, 9, 9).
+inline void fftdit_9_9(T *p) {
+  uint64_t v0 = p[0].a;
+  uint64_t v1 = p[0].b;
+  uint64_t v2 = p[1].a;
+  uint64_t v3 = p[1].b;
+  uint64_t v4 = p[2].a;
+  uint64_t v5 = p[2].b;
+  uint64_t v6 = p[3].a;
+  uint64_t v7 = p[3].b;
+  uint64_t v8 = p[4].a;
+  uint64_t v9 = p[4].b;
+  uint64_t v10 = p[5].a;
+  uint64_t v11 = p[5].b;
+  uint64_t v12 = p[6].a;
+  uint64_t v13 = p[6].b;
+  uint64_t v14 = p[7].a;
+  uint64_t v15 = p[7].b;
+  uint64_t v16 = p[8].a;
+  uint64_t v17 = p[8].b;
+  uint64_t v18 = p[9].a;
+  uint64_t v19 = p[9].b;
+  uint64_t v20 = p[10].a;
+  uint64_t v21 = p[10].b;
+  uint64_t v22 = p[11].a;
+  uint64_t v23 = p[11].b;
+  uint64_t v24 = p[12].a;
+  uint64_t v25 = p[12].b;
+  uint64_t v26 = p[13].a;
+  uint64_t v27 = p[13].b;
+  uint64_t v28 = p[14].a;
+  uint64_t v29 = p[14].b;
+  uint64_t v30 = p[15].a;
+  uint64_t v31 = p[15].b;
+  uint64_t v32 = p[16].a;
+  uint64_t v33 = p[16].b;
+  uint64_t v34 = p[17].a;
+  uint64_t v35 = p[17].b;
+  uint64_t v36 = p[18].a;
+  uint64_t v37 = p[18].b;
+  uint64_t v38 = p[19].a;
+  uint64_t v39 = p[19].b;
+  uint64_t v40 = p[20].a;
+  uint64_t v41 = p[20].b;
+  uint64_t v42 = p[21].a;
+  uint64_t v43 = p[21].b;
+  uint64_t v44 = p[22].a;
+  uint64_t v45 = p[22].b;
+  uint64_t v46 = p[23].a;
+  uint64_t v47 = p[23].b;
+  uint64_t v48 = p[24].a;
+  uint64_t v49 = p[24].b;
+  uint64_t v50 = p[25].a;
+  uint64_t v51 = p[25].b;
+  uint64_t v52 = p[26].a;
+  uint64_t v53 = p[26].b;
+  uint64_t v54 = p[27].a;
+  uint64_t v55 = p[27].b;
+  uint64_t v56 = p[28].a;
+  uint64_t v57 = p[28].b;
+  uint64_t v58 = p[29].a;
+  uint64_t v59 = p[29].b;
+  uint64_t v60 = p[30].a;
+  uint64_t v61 = p[30].b;
+  uint64_t v62 = p[31].a;
+  uint64_t v63 = p[31].b;
+  uint64_t v64 = p[32].a;
+  uint64_t v65 = p[32].b;
+  uint64_t v66 = p[33].a;
+  uint64_t v67 = p[33].b;
+  uint64_t v68 = p[34].a;
+  uint64_t v69 = p[34].b;
+  uint64_t v70 = p[35].a;
+  uint64_t v71 = p[35].b;
+  uint64_t v72 = p[36].a;
+  uint64_t v73 = p[36].b;
+  uint64_t v74 = p[37].a;
+  uint64_t v75 = p[37].b;
+  uint64_t v76 = p[38].a;
+  uint64_t v77 = p[38].b;
+  uint64_t v78 = p[39].a;
+  uint64_t v79 = p[39].b;
+  uint64_t v80 = p[40].a;
+  uint64_t v81 = p[40].b;
+  uint64_t v82 = p[41].a;
+  uint64_t v83 = p[41].b;
+  uint64_t v84 = p[42].a;
+  uint64_t v85 = p[42].b;
+  uint64_t v86 = p[43].a;
+  uint64_t v87 = p[43].b;
+  uint64_t v88 = p[44].a;
+  uint64_t v89 = p[44].b;
+  uint64_t v90 = p[45].a;
+  uint64_t v91 = p[45].b;
+  uint64_t v92 = p[46].a;
+  uint64_t v93 = p[46].b;
+  uint64_t v94 = p[47].a;
+  uint64_t v95 = p[47].b;
+  uint64_t v96 = p[48].a;
+  uint64_t v97 = p[48].b;
+  uint64_t v98 = p[49].a;
+  uint64_t v99 = p[49].b;
+  uint64_t v100 = p[50].a;
+  uint64_t v101 = p[50].b;
+  uint64_t v102 = p[51].a;
+  uint64_t v103 = p[51].b;
+  uint64_t v104 = p[52].a;
+  uint64_t v105 = p[52].b;
+  uint64_t v106 = p[53].a;
+  uint64_t v107 = p[53].b;
+  uint64_t v108 = p[54].a;
+  uint64_t v109 = p[54].b;
+  uint64_t v110 = p[55].a;
+  uint64_t v111 = p[55].b;
+  uint64_t v112 = p[56].a;
+  uint64_t v113 = p[56].b;
+  uint64_t v114 = p[57].a;
+  uint64_t v115 = p[57].b;
+  uint64_t v116 = p[58].a;
+  uint64_t v117 = p[58].b;
+  uint64_t v118 = p[59].a;
+  uint64_t v119 = p[59].b;
+  uint64_t v120 = p[60].a;
+  uint64_t v121 = p[60].b;
+  uint64_t v122 = p[61].a;
+  uint64_t v123 = p[61].b;
+  uint64_t v124 = p[62].a;
+  uint64_t v125 = p[62].b;
+  uint64_t v126 = p[63].a;
+  uint64_t v127 = p[63].b;
+  uint64_t v128 = p[64].a;
+  uint64_t v129 = p[64].b;
+  uint64_t v130 = p[65].a;
+  uint64_t v131 = p[65].b;
+  uint64_t v132 = p[66].a;
+  uint64_t v133 = p[66].b;
+  uint64_t v134 = p[67].a;
+  uint64_t v135 = p[67].b;
+  uint64_t v136 = p[68].a;
+  uint64_t v137 = p[68].b;
+  uint64_t v138 = p[69].a;
+  uint64_t v139 = p[69].b;
+  uint64_t v140 = p[70].a;
+  uint64_t v141 = p[70].b;
+  uint64_t v142 = p[71].a;
+  uint64_t v143 = p[71].b;
+  uint64_t v144 = p[72].a;
+  uint64_t v145 = p[72].b;
+  uint64_t v146 = p[73].a;
+  uint64_t v147 = p[73].b;
+  uint64_t v148 = p[74].a;
+  uint64_t v149 = p[74].b;
+  uint64_t v150 = p[75].a;
+  uint64_t v151 = p[75].b;
+  uint64_t v152 = p[76].a;
+  uint64_t v153 = p[76].b;
+  uint64_t v154 = p[77].a;
+  uint64_t v155 = p[77].b;
+  uint64_t v156 = p[78].a;
+  uint64_t v157 = p[78].b;
+  uint64_t v158 = p[79].a;
+  uint64_t v159 = p[79].b;
+  uint64_t v160 = p[80].a;
+  uint64_t v161 = p[80].b;
+  uint64_t v162 = v18 + v36;
+  uint64_t v163 = v19 + v37;
+  uint64_t v164 = v19 - v37;
+  uint64_t v165 = v18 - v36;
+  uint64_t v166 = v0 + v162;
+  uint64_t v167 = v1 + v163;
+  uint64_t v168 = v0 - v164;
+  uint64_t v169 = v168 - v36;
+  uint64_t v170 = v1 + v165;
+  uint64_t v171 = v170 - v19;
+  uint64_t v172 = v0 + v164;
+  uint64_t v173 = v172 - v18;
+  uint64_t v174 = v1 - v165;
+  uint64_t v175 = v174 - v37;
+  uint64_t v176 = v20 + v38;
+  uint64_t v177 = v21 + v39;
+  uint64_t v178 = v21 - v39;
+  uint64_t v179 = v20 - v38;
+  uint64_t v180 = v2 + v176;
+  uint64_t v181 = v3 + v177;
+  uint64_t v182 = v2 - v178;
+  uint64_t v183 = v182 - v38;
+  uint64_t v184 = v3 + v179;
+  uint64_t v185 = v184 - v21;
+  uint64_t v186 = v2 + v178;
+  uint64_t v187 = v186 - v20;
+  uint64_t v188 = v3 - v179;
+  uint64_t v189 = v188 - v39;
+  uint64_t v190 = v22 + v40;
+  uint64_t v191 = v23 + v41;
+  uint64_t v192 = v23 - v41;
+  uint64_t v193 = v22 - v40;
+  uint64_t v194 = v4 + v190;
+  uint64_t v195 = v5 + v191;
+  uint64_t v196 = v4 - v192;
+  uint64_t v197 = v196 - v40;
+  uint64_t v198 = v5 + v193;
+  uint64_t v199 = v198 - v23;
+  uint64_t v200 = v4 + v192;
+  uint64_t v201 = v200 - v22;
+  uint64_t v202 = v5 - v193;
+  uint64_t v203 = v202 - v41;
+  uint64_t v204 = v24 + v42;
+  uint64_t v205 = v25 + v43;
+  uint64_t v206 = v25 - v43;
+  uint64_t v207 = v24 - v42;
+  uint64_t v208 = v6 + v204;
+  uint64_t v209 = v7 + v205;
+  uint64_t v210 = v6 - v206;
+  uint64_t v211 = v210 - v42;
+  uint64_t v212 = v7 + v207;
+  uint64_t v213 = v212 - v25;
+  uint64_t v214 = v6 + v206;
+  uint64_t v215 = v214 - v24;
+  uint64_t v216 = v7 - v207;
+  uint64_t v217 = v216 - v43;
+  uint64_t v218 = v26 + v44;
+  uint64_t v219 = v27 + v45;
+  uint64_t v220 = v27 - v45;
+  uint64_t v221 = v26 - v44;
+  uint64_t v222 = v8 + v218;
+  uint64_t v223 = v9 + v219;
+  uint64_t v224 = v8 - v220;
+  uint64_t v225 = v224 - v44;
+  uint64_t v226 = v9 + v221;
+  uint64_t v227 = v226 - v27;
+  uint64_t v228 = v8 + v220;
+  uint64_t v229 = v228 - v26;
+  uint64_t v230 = v9 - v221;
+  uint64_t v231 = v230 - v45;
+  uint64_t v232 = v28 + v46;
+  uint64_t v233 = v29 + v47;
+  uint64_t v234 = v29 - v47;
+  uint64_t v235 = v28 - v46;
+  uint64_t v236 = v10 + v232;
+  uint64_t v237 = v11 + v233;
+  uint64_t v238 = v10 - v234;
+  uint64_t v239 = v238 - v46;
+  uint64_t v240 = v11 + v235;
+  uint64_t v241 = v240 - v29;
+  uint64_t v242 = v10 + v234;
+  uint64_t v243 = v242 - v28;
+  uint64_t v244 = v11 - v235;
+  uint64_t v245 = v244 - v47;
+  uint64_t v246 = v30 + v48;
+  uint64_t v247 = v31 + v49;
+  uint64_t v248 = v31 - v49;
+  uint64_t v249 = v30 - v48;
+  uint64_t v250 = v12 + v246;
+  uint64_t v251 = v13 + v247;
+  uint64_t v252 = v12 - v248;
+  uint64_t v253 = v252 - v48;
+  uint64_t v254 = v13 + v249;
+  uint64_t v255 = v254 - v31;
+  uint64_t v256 = v12 + v248;
+  uint64_t v257 = v256 - v30;
+  uint64_t v258 = v13 - v249;
+  uint64_t v259 = v258 - v49;
+  uint64_t v260 = v32 + v50;
+  uint64_t v261 = v33 + v51;
+  uint64_t v262 = v33 - v51;
+  uint64_t v263 = v32 - v50;
+  uint64_t v264 = v14 + v260;
+  uint64_t v265 = v15 + v261;
+  uint64_t v266 = v14 - v262;
+  uint64_t v267 = v266 - v50;
+  uint64_t v268 = v15 + v263;
+  uint64_t v269 = v268 - v33;
+  uint64_t v270 = v14 + v262;
+  uint64_t v271 = v270 - v32;
+  uint64_t v272 = v15 - v263;
+  uint64_t v273 = v272 - v51;
+  uint64_t v274 = v34 + v52;
+  uint64_t v275 = v35 + v53;
+  uint64_t v276 = v35 - v53;
+  uint64_t v277 = v34 - v52;
+  uint64_t v278 = v16 + v274;
+  uint64_t v279 = v17 + v275;
+  uint64_t v280 = v16 - v276;
+  uint64_t v281 = v280 - v52;
+  uint64_t v282 = v17 + v277;
+  uint64_t v283 = v282 - v35;
+  uint64_t v284 = v16 + v276;
+  uint64_t v285 = v284 - v34;
+  uint64_t v286 = v17 - v277;
+  uint64_t v287 = v286 - v53;
+  uint64_t v288 = v72 + v90;
+  uint64_t v289 = v73 + v91;
+  uint64_t v290 = v73 - v91;
+  uint64_t v291 = v72 - v90;
+  uint64_t v292 = v54 + v288;
+  uint64_t v293 = v55 + v289;
+  uint64_t v294 = v54 - v290;
+  uint64_t v295 = v294 - v90;
+  uint64_t v296 = v55 + v291;
+  uint64_t v297 = v296 - v73;
+  uint64_t v298 = v54 + v290;
+  uint64_t v299 = v298 - v72;
+  uint64_t v300 = v55 - v291;
+  uint64_t v301 = v300 - v91;
+  uint64_t v302 = v74 + v92;
+  uint64_t v303 = v75 + v93;
+  uint64_t v304 = v75 - v93;
+  uint64_t v305 = v74 - v92;
+  uint64_t v306 = v56 + v302;
+  uint64_t v307 = v57 + v303;
+  uint64_t v308 = v56 - v304;
+  uint64_t v309 = v308 - v92;
+  uint64_t v310 = v57 + v305;
+  uint64_t v311 = v310 - v75;
+  uint64_t v312 = v56 + v304;
+  uint64_t v313 = v312 - v74;
+  uint64_t v314 = v57 - v305;
+  uint64_t v315 = v314 - v93;
+  uint64_t v316 = v76 + v94;
+  uint64_t v317 = v77 + v95;
+  uint64_t v318 = v77 - v95;
+  uint64_t v319 = v76 - v94;
+  uint64_t v320 = v58 + v316;
+  uint64_t v321 = v59 + v317;
+  uint64_t v322 = v58 - v318;
+  uint64_t v323 = v322 - v94;
+  uint64_t v324 = v59 + v319;
+  uint64_t v325 = v324 - v77;
+  uint64_t v326 = v58 + v318;
+  uint64_t v327 = v326 - v76;
+  uint64_t v328 = v59 - v319;
+  uint64_t v329 = v328 - v95;
+  uint64_t v330 = v78 + v96;
+  uint64_t v331 = v79 + v97;
+  uint64_t v332 = v79 - v97;
+  uint64_t v333 = v78 - v96;
+  uint64_t v334 = v60 + v330;
+  uint64_t v335 = v61 + v331;
+  uint64_t v336 = v60 - v332;
+  uint64_t v337 = v336 - v96;
+  uint64_t v338 = v61 + v333;
+  uint64_t v339 = v338 - v79;
+  uint64_t v340 = v60 + v332;
+  uint64_t v341 = v340 - v78;
+  uint64_t v342 = v61 - v333;
+  uint64_t v343 = v342 - v97;
+  uint64_t v344 = v80 + v98;
+  uint64_t v345 = v81 + v99;
+  uint64_t v346 = v81 - v99;
+  uint64_t v347 = v80 - v98;
+  uint64_t v348 = v62 + v344;
+  uint64_t v349 = v63 + v345;
+  uint64_t v350 = v62 - v346;
+  uint64_t v351 = v350 - v98;
+  uint64_t v352 = v63 + v347;
+  uint64_t v353 = v352 - v81;
+  uint64_t v354 = v62 + v346;
+  uint64_t v355 = v354 - v80;
+  uint64_t v356 = v63 - v347;
+  uint64_t v357 = v356 - v99;
+  uint64_t v358 = v82 + v100;
+  uint64_t v359 = v83 + v101;
+  uint64_t v360 = v83 - v101;
+  uint64_t v361 = v82 - v100;
+  uint64_t v362 = v64 + v358;
+  uint64_t v363 = v65 + v359;
+  uint64_t v364 = v64 - v360;
+  uint64_t v365 = v364 - v100;
+  uint64_t v366 = v65 + v361;
+  uint64_t v367 = v366 - v83;
+  uint64_t v368 = v64 + v360;
+  uint64_t v369 = v368 - v82;
+  uint64_t v370 = v65 - v361;
+  uint64_t v371 = v370 - v101;
+  uint64_t v372 = v84 + v102;
+  uint64_t v373 = v85 + v103;
+  uint64_t v374 = v85 - v103;
+  uint64_t v375 = v84 - v102;
+  uint64_t v376 = v66 + v372;
+  uint64_t v377 = v67 + v373;
+  uint64_t v378 = v66 - v374;
+  uint64_t v379 = v378 - v102;
+  uint64_t v380 = v67 + v375;
+  uint64_t v381 = v380 - v85;
+  uint64_t v382 = v66 + v374;
+  uint64_t v383 = v382 - v84;
+  uint64_t v384 = v67 - v375;
+  uint64_t v385 = v384 - v103;
+  uint64_t v386 = v86 + v104;
+  uint64_t v387 = v87 + v105;
+  uint64_t v388 = v87 - v105;
+  uint64_t v389 = v86 - v104;
+  uint64_t v390 = v68 + v386;
+  uint64_t v391 = v69 + v387;
+  uint64_t v392 = v68 - v388;
+  uint64_t v393 = v392 - v104;
+  uint64_t v394 = v69 + v389;
+  uint64_t v395 = v394 - v87;
+  uint64_t v396 = v68 + v388;
+  uint64_t v397 = v396 - v86;
+  uint64_t v398 = v69 - v389;
+  uint64_t v399 = v398 - v105;
+  uint64_t v400 = v88 + v106;
+  uint64_t v401 = v89 + v107;
+  uint64_t v402 = v89 - v107;
+  uint64_t v403 = v88 - v106;
+  uint64_t v404 = v70 + v400;
+  uint64_t v405 = v71 + v401;
+  uint64_t v406 = v70 - v402;
+  uint64_t v407 = v406 - v106;
+  uint64_t v408 = v71 + v403;
+  uint64_t v409 = v408 - v89;
+  uint64_t v410 = v70 + v402;
+  uint64_t v411 = v410 - v88;
+  uint64_t v412 = v71 - v403;
+  uint64_t v413 = v412 - v107;
+  uint64_t v414 = v126 + v144;
+  uint64_t v415 = v127 + v145;
+  uint64_t v416 = v127 - v145;
+  uint64_t v417 = v126 - v144;
+  uint64_t v418 = v108 + v414;
+  uint64_t v419 = v109 + v415;
+  uint64_t v420 = v108 - v416;
+  uint64_t v421 = v420 - v144;
+  uint64_t v422 = v109 + v417;
+  uint64_t v423 = v422 - v127;
+  uint64_t v424 = v108 + v416;
+  uint64_t v425 = v424 - v126;
+  uint64_t v426 = v109 - v417;
+  uint64_t v427 = v426 - v145;
+  uint64_t v428 = v128 + v146;
+  uint64_t v429 = v129 + v147;
+  uint64_t v430 = v129 - v147;
+  uint64_t v431 = v128 - v146;
+  uint64_t v432 = v110 + v428;
+  uint64_t v433 = v111 + v429;
+  uint64_t v434 = v110 - v430;
+  uint64_t v435 = v434 - v146;
+  uint64_t v436 = v111 + v431;
+  uint64_t v437 = v436 - v129;
+  uint64_t v438 = v110 + v430;
+  uint64_t v439 = v438 - v128;
+  uint64_t v440 = v111 - v431;
+  uint64_t v441 = v440 - v147;
+  uint64_t v442 = v130 + v148;
+  uint64_t v443 = v131 + v149;
+  uint64_t v444 = v131 - v149;
+  uint64_t v445 = v130 - v148;
+  uint64_t v446 = v112 + v442;
+  uint64_t v447 = v113 + v443;
+  uint64_t v448 = v112 - v444;
+  uint64_t v449 = v448 - v148;
+  uint64_t v450 = v113 + v445;
+  uint64_t v451 = v450 - v131;
+  uint64_t v452 = v112 + v444;
+  uint64_t v453 = v452 - v130;
+  uint64_t v454 = v113 - v445;
+  uint64_t v455 = v454 - v149;
+  uint64_t v456 = v132 + v150;
+  uint64_t v457 = v133 + v151;
+  uint64_t v458 = v133 - v151;
+  uint64_t v459 = v132 - v150;
+  uint64_t v460 = v114 + v456;
+  uint64_t v461 = v115 + v457;
+  uint64_t v462 = v114 - v458;
+  uint64_t v463 = v462 - v150;
+  uint64_t v464 = v115 + v459;
+  uint64_t v465 = v464 - v133;
+  uint64_t v466 = v114 + v458;
+  uint64_t v467 = v466 - v132;
+  uint64_t v468 = v115 - v459;
+  uint64_t v469 = v468 - v151;
+  uint64_t v470 = v134 + v152;
+  uint64_t v471 = v135 + v153;
+  uint64_t v472 = v135 - v153;
+  uint64_t v473 = v134 - v152;
+  uint64_t v474 = v116 + v470;
+  uint64_t v475 = v117 + v471;
+  uint64_t v476 = v116 - v472;
+  uint64_t v477 = v476 - v152;
+  uint64_t v478 = v117 + v473;
+  uint64_t v479 = v478 - v135;
+  uint64_t v480 = v116 + v472;
+  uint64_t v481 = v480 - v134;
+  uint64_t v482 = v117 - v473;
+  uint64_t v483 = v482 - v153;
+  uint64_t v484 = v136 + v154;
+  uint64_t v485 = v137 + v155;
+  uint64_t v486 = v137 - v155;
+  uint64_t v487 = v136 - v154;
+  uint64_t v488 = v118 + v484;
+  uint64_t v489 = v119 + v485;
+  uint64_t v490 = v118 - v486;
+  uint64_t v491 = v490 - v154;
+  uint64_t v492 = v119 + v487;
+  uint64_t v493 = v492 - v137;
+  uint64_t v494 = v118 + v486;
+  uint64_t v495 = v494 - v136;
+  uint64_t v496 = v119 - v487;
+  uint64_t v497 = v496 - v155;
+  uint64_t v498 = v138 + v156;
+  uint64_t v499 = v139 + v157;
+  uint64_t v500 = v139 - v157;
+  uint64_t v501 = v138 - v156;
+  uint64_t v502 = v120 + v498;
+  uint64_t v503 = v121 + v499;
+  uint64_t v504 = v120 - v500;
+  uint64_t v505 = v504 - v156;
+  uint64_t v506 = v121 + v501;
+  uint64_t v507 = v506 - v139;
+  uint64_t v508 = v120 + v500;
+  uint64_t v509 = v508 - v138;
+  uint64_t v510 = v121 - v501;
+  uint64_t v511 = v510 - v157;
+  uint64_t v512 = v140 + v158;
+  uint64_t v513 = v141 + v159;
+  uint64_t v514 = v141 - v159;
+  uint64_t v515 = v140 - v158;
+  uint64_t v516 = v122 + v512;
+  uint64_t v517 = v123 + v513;
+  uint64_t v518 = v122 - v514;
+  uint64_t v519 = v518 - v158;
+  uint64_t v520 = v123 + v515;
+  uint64_t v521 = v520 - v141;
+  uint64_t v522 = v122 + v514;
+  uint64_t v523 = v522 - v140;
+  uint64_t v524 = v123 - v515;
+  uint64_t v525 = v524 - v159;
+  uint64_t v526 = v142 + v160;
+  uint64_t v527 = v143 + v161;
+  uint64_t v528 = v143 - v161;
+  uint64_t v529 = v142 - v160;
+  uint64_t v530 = v124 + v526;
+  uint64_t v531 = v125 + v527;
+  uint64_t v532 = v124 - v528;
+  uint64_t v533 = v532 - v160;
+  uint64_t v534 = v125 + v529;
+  uint64_t v535 = v534 - v143;
+  uint64_t v536 = v124 + v528;
+  uint64_t v537 = v536 - v142;
+  uint64_t v538 = v125 - v529;
+  uint64_t v539 = v538 - v161;
+  uint64_t v540 = v292 + v418;
+  uint64_t v541 = v293 + v419;
+  uint64_t v542 = v293 - v419;
+  uint64_t v543 = v292 - v418;
+  uint64_t v544 = v166 + v540;
+  uint64_t v545 = v167 + v541;
+  uint64_t v546 = v166 - v542;
+  uint64_t v547 = v546 - v418;
+  uint64_t v548 = v167 + v543;
+  uint64_t v549 = v548 - v293;
+  uint64_t v550 = v166 + v542;
+  uint64_t v551 = v550 - v292;
+  uint64_t v552 = v167 - v543;
+  uint64_t v553 = v552 - v419;
+  uint64_t v554 = v306 + v432;
+  uint64_t v555 = v307 + v433;
+  uint64_t v556 = v307 - v433;
+  uint64_t v557 = v306 - v432;
+  uint64_t v558 = v180 + v554;
+  uint64_t v559 = v181 + v555;
+  uint64_t v560 = v180 - v556;
+  uint64_t v561 = v560 - v432;
+  uint64_t v562 = v181 + v557;
+  uint64_t v563 = v562 - v307;
+  uint64_t v564 = v180 + v556;
+  uint64_t v565 = v564 - v306;
+  uint64_t v566 = v181 - v557;
+  uint64_t v567 = v566 - v433;
+  uint64_t v568 = v320 + v446;
+  uint64_t v569 = v321 + v447;
+  uint64_t v570 = v321 - v447;
+  uint64_t v571 = v320 - v446;
+  uint64_t v572 = v194 + v568;
+  uint64_t v573 = v195 + v569;
+  uint64_t v574 = v194 - v570;
+  uint64_t v575 = v574 - v446;
+  uint64_t v576 = v195 + v571;
+  uint64_t v577 = v576 - v321;
+  uint64_t v578 = v194 + v570;
+  uint64_t v579 = v578 - v320;
+  uint64_t v580 = v195 - v571;
+  uint64_t v581 = v580 - v447;
+  uint64_t v582 = v334 + v460;
+  uint64_t v583 = v335 + v461;
+  uint64_t v584 = v335 - v461;
+  uint64_t v585 = v334 - v460;
+  uint64_t v586 = v208 + v582;
+  uint64_t v587 = v209 + v583;
+  uint64_t v588 = v208 - v584;
+  uint64_t v589 = v588 - v460;
+  uint64_t v590 = v209 + v585;
+  uint64_t v591 = v590 - v335;
+  uint64_t v592 = v208 + v584;
+  uint64_t v593 = v592 - v334;
+  uint64_t v594 = v209 - v585;
+  uint64_t v595 = v594 - v461;
+  uint64_t v596 = v348 + v474;
+  uint64_t v597 = v349 + v475;
+  uint64_t v598 = v349 - v475;
+  uint64_t v599 = v348 - v474;
+  uint64_t v600 = v222 + v596;
+  uint64_t v601 = v223 + v597;
+  uint64_t v602 = v222 - v598;
+  uint64_t v603 = v602 - v474;
+  uint64_t v604 = v223 + v599;
+  uint64_t v605 = v604 - v349;
+  uint64_t v606 = v222 + v598;
+  uint64_t v607 = v606 - v348;
+  uint64_t v608 = v223 - v599;
+  uint64_t v609 = v608 - v475;
+  uint64_t v610 = v362 + v488;
+  uint64_t v611 = v363 + v489;
+  uint64_t v612 = v363 - v489;
+  uint64_t v613 = v362 - v488;
+  uint64_t v614 = v236 + v610;
+  uint64_t v615 = v237 + v611;
+  uint64_t v616 = v236 - v612;
+  uint64_t v617 = v616 - v488;
+  uint64_t v618 = v237 + v613;
+  uint64_t v619 = v618 - v363;
+  uint64_t v620 = v236 + v612;
+  uint64_t v621 = v620 - v362;
+  uint64_t v622 = v237 - v613;
+  uint64_t v623 = v622 - v489;
+  uint64_t v624 = v376 + v502;
+  uint64_t v625 = v377 + v503;
+  uint64_t v626 = v377 - v503;
+  uint64_t v627 = v376 - v502;
+  uint64_t v628 = v250 + v624;
+  uint64_t v629 = v251 + v625;
+  uint64_t v630 = v250 - v626;
+  uint64_t v631 = v630 - v502;
+  uint64_t v632 = v251 + v627;
+  uint64_t v633 = v632 - v377;
+  uint64_t v634 = v250 + v626;
+  uint64_t v635 = v634 - v376;
+  uint64_t v636 = v251 - v627;
+  uint64_t v637 = v636 - v503;
+  uint64_t v638 = v390 + v516;
+  uint64_t v639 = v391 + v517;
+  uint64_t v640 = v391 - v517;
+  uint64_t v641 = v390 - v516;
+  uint64_t v642 = v264 + v638;
+  uint64_t v643 = v265 + v639;
+  uint64_t v644 = v264 - v640;
+  uint64_t v645 = v644 - v516;
+  uint64_t v646 = v265 + v641;
+  uint64_t v647 = v646 - v391;
+  uint64_t v648 = v264 + v640;
+  uint64_t v649 = v648 - v390;
+  uint64_t v650 = v265 - v641;
+  uint64_t v651 = v650 - v517;
+  uint64_t v652 = v404 + v530;
+  uint64_t v653 = v405 + v531;
+  uint64_t v654 = v405 - v531;
+  uint64_t v655 = v404 - v530;
+  uint64_t v656 = v278 + v652;
+  uint64_t v657 = v279 + v653;
+  uint64_t v658 = v278 - v654;
+  uint64_t v659 = v658 - v530;
+  uint64_t v660 = v279 + v655;
+  uint64_t v661 = v660 - v405;
+  uint64_t v662 = v278 + v654;
+  uint64_t v663 = v662 - v404;
+  uint64_t v664 = v279 - v655;
+  uint64_t v665 = v664 - v531;
+  uint64_t v666 = v301 - v299;
+  uint64_t v667 = v315 - v313;
+  uint64_t v668 = v329 - v327;
+  uint64_t v669 = v427 - v425;
+  uint64_t v670 = v441 - v439;
+  uint64_t v671 = v455 - v453;
+  uint64_t v672 = v469 - v467;
+  uint64_t v673 = v483 - v481;
+  uint64_t v674 = v497 - v495;
+  uint64_t v675 = v341 + v509;
+  uint64_t v676 = v343 + v511;
+  uint64_t v677 = v343 - v511;
+  uint64_t v678 = v341 - v509;
+  uint64_t v679 = v173 + v675;
+  uint64_t v680 = v175 + v676;
+  uint64_t v681 = v173 - v677;
+  uint64_t v682 = v681 - v509;
+  uint64_t v683 = v175 + v678;
+  uint64_t v684 = v683 - v343;
+  uint64_t v685 = v173 + v677;
+  uint64_t v686 = v685 - v341;
+  uint64_t v687 = v175 - v678;
+  uint64_t v688 = v687 - v511;
+  uint64_t v689 = v355 + v523;
+  uint64_t v690 = v357 + v525;
+  uint64_t v691 = v357 - v525;
+  uint64_t v692 = v355 - v523;
+  uint64_t v693 = v187 + v689;
+  uint64_t v694 = v189 + v690;
+  uint64_t v695 = v187 - v691;
+  uint64_t v696 = v695 - v523;
+  uint64_t v697 = v189 + v692;
+  uint64_t v698 = v697 - v357;
+  uint64_t v699 = v187 + v691;
+  uint64_t v700 = v699 - v355;
+  uint64_t v701 = v189 - v692;
+  uint64_t v702 = v701 - v525;
+  uint64_t v703 = v369 + v537;
+  uint64_t v704 = v371 + v539;
+  uint64_t v705 = v371 - v539;
+  uint64_t v706 = v369 - v537;
+  uint64_t v707 = v201 + v703;
+  uint64_t v708 = v203 + v704;
+  uint64_t v709 = v201 - v705;
+  uint64_t v710 = v709 - v537;
+  uint64_t v711 = v203 + v706;
+  uint64_t v712 = v711 - v371;
+  uint64_t v713 = v201 + v705;
+  uint64_t v714 = v713 - v369;
+  uint64_t v715 = v203 - v706;
+  uint64_t v716 = v715 - v539;
+  uint64_t v717 = v383 + v669;
+  uint64_t v718 = v385 - v425;
+  uint64_t v719 = v385 + v425;
+  uint64_t v720 = v383 - v669;
+  uint64_t v721 = v215 + v717;
+  uint64_t v722 = v217 + v718;
+  uint64_t v723 = v215 - v719;
+  uint64_t v724 = v723 - v669;
+  uint64_t v725 = v217 + v720;
+  uint64_t v726 = v725 - v385;
+  uint64_t v727 = v215 + v719;
+  uint64_t v728 = v727 - v383;
+  uint64_t v729 = v217 - v720;
+  uint64_t v730 = v729 + v425;
+  uint64_t v731 = v397 + v670;
+  uint64_t v732 = v399 - v439;
+  uint64_t v733 = v399 + v439;
+  uint64_t v734 = v397 - v670;
+  uint64_t v735 = v229 + v731;
+  uint64_t v736 = v231 + v732;
+  uint64_t v737 = v229 - v733;
+  uint64_t v738 = v737 - v670;
+  uint64_t v739 = v231 + v734;
+  uint64_t v740 = v739 - v399;
+  uint64_t v741 = v229 + v733;
+  uint64_t v742 = v741 - v397;
+  uint64_t v743 = v231 - v734;
+  uint64_t v744 = v743 + v439;
+  uint64_t v745 = v411 + v671;
+  uint64_t v746 = v413 - v453;
+  uint64_t v747 = v413 + v453;
+  uint64_t v748 = v411 - v671;
+  uint64_t v749 = v243 + v745;
+  uint64_t v750 = v245 + v746;
+  uint64_t v751 = v243 - v747;
+  uint64_t v752 = v751 - v671;
+  uint64_t v753 = v245 + v748;
+  uint64_t v754 = v753 - v413;
+  uint64_t v755 = v243 + v747;
+  uint64_t v756 = v755 - v411;
+  uint64_t v757 = v245 - v748;
+  uint64_t v758 = v757 + v453;
+  uint64_t v759 = v666 + v672;
+  uint64_t v760 = v299 + v467;
+  uint64_t v761 = v467 - v299;
+  uint64_t v762 = v666 - v672;
+  uint64_t v763 = v257 + v759;
+  uint64_t v764 = v259 - v760;
+  uint64_t v765 = v257 - v761;
+  uint64_t v766 = v765 - v672;
+  uint64_t v767 = v259 + v762;
+  uint64_t v768 = v767 + v299;
+  uint64_t v769 = v257 + v761;
+  uint64_t v770 = v769 - v666;
+  uint64_t v771 = v259 - v762;
+  uint64_t v772 = v771 + v467;
+  uint64_t v773 = v667 + v673;
+  uint64_t v774 = v313 + v481;
+  uint64_t v775 = v481 - v313;
+  uint64_t v776 = v667 - v673;
+  uint64_t v777 = v271 + v773;
+  uint64_t v778 = v273 - v774;
+  uint64_t v779 = v271 - v775;
+  uint64_t v780 = v779 - v673;
+  uint64_t v781 = v273 + v776;
+  uint64_t v782 = v781 + v313;
+  uint64_t v783 = v271 + v775;
+  uint64_t v784 = v783 - v667;
+  uint64_t v785 = v273 - v776;
+  uint64_t v786 = v785 + v481;
+  uint64_t v787 = v668 + v674;
+  uint64_t v788 = v327 + v495;
+  uint64_t v789 = v495 - v327;
+  uint64_t v790 = v668 - v674;
+  uint64_t v791 = v285 + v787;
+  uint64_t v792 = v287 - v788;
+  uint64_t v793 = v285 - v789;
+  uint64_t v794 = v793 - v674;
+  uint64_t v795 = v287 + v790;
+  uint64_t v796 = v795 + v327;
+  uint64_t v797 = v285 + v789;
+  uint64_t v798 = v797 - v668;
+  uint64_t v799 = v287 - v790;
+  uint64_t v800 = v799 + v495;
+  uint64_t v801 = v297 - v295;
+  uint64_t v802 = v311 - v309;
+  uint64_t v803 = v325 - v323;
+  uint64_t v804 = v339 - v337;
+  uint64_t v805 = v353 - v351;
+  uint64_t v806 = v367 - v365;
+  uint64_t v807 = v421 - v423;
+  uint64_t v808 = v435 - v437;
+  uint64_t v809 = v449 - v451;
+  uint64_t v810 = v465 - v463;
+  uint64_t v811 = v479 - v477;
+  uint64_t v812 = v493 - v491;
+  uint64_t v813 = v507 - v505;
+  uint64_t v814 = v521 - v519;
+  uint64_t v815 = v535 - v533;
+  uint64_t v816 = v379 + v810;
+  uint64_t v817 = v381 - v463;
+  uint64_t v818 = v381 + v463;
+  uint64_t v819 = v379 - v810;
+  uint64_t v820 = v169 + v816;
+  uint64_t v821 = v171 + v817;
+  uint64_t v822 = v169 - v818;
+  uint64_t v823 = v822 - v810;
+  uint64_t v824 = v171 + v819;
+  uint64_t v825 = v824 - v381;
+  uint64_t v826 = v169 + v818;
+  uint64_t v827 = v826 - v379;
+  uint64_t v828 = v171 - v819;
+  uint64_t v829 = v828 + v463;
+  uint64_t v830 = v393 + v811;
+  uint64_t v831 = v395 - v477;
+  uint64_t v832 = v395 + v477;
+  uint64_t v833 = v393 - v811;
+  uint64_t v834 = v183 + v830;
+  uint64_t v835 = v185 + v831;
+  uint64_t v836 = v183 - v832;
+  uint64_t v837 = v836 - v811;
+  uint64_t v838 = v185 + v833;
+  uint64_t v839 = v838 - v395;
+  uint64_t v840 = v183 + v832;
+  uint64_t v841 = v840 - v393;
+  uint64_t v842 = v185 - v833;
+  uint64_t v843 = v842 + v477;
+  uint64_t v844 = v407 + v812;
+  uint64_t v845 = v409 - v491;
+  uint64_t v846 = v409 + v491;
+  uint64_t v847 = v407 - v812;
+  uint64_t v848 = v197 + v844;
+  uint64_t v849 = v199 + v845;
+  uint64_t v850 = v197 - v846;
+  uint64_t v851 = v850 - v812;
+  uint64_t v852 = v199 + v847;
+  uint64_t v853 = v852 - v409;
+  uint64_t v854 = v197 + v846;
+  uint64_t v855 = v854 - v407;
+  uint64_t v856 = v199 - v847;
+  uint64_t v857 = v856 + v491;
+  uint64_t v858 = v801 + v813;
+  uint64_t v859 = v295 + v505;
+  uint64_t v860 = v505 - v295;
+  uint64_t v861 = v801 - v813;
+  uint64_t v862 = v211 + v858;
+  uint64_t v863 = v213 - v859;
+  uint64_t v864 = v211 - v860;
+  uint64_t v865 = v864 - v813;
+  uint64_t v866 = v213 + v861;
+  uint64_t v867 = v866 + v295;
+  uint64_t v868 = v211 + v860;
+  uint64_t v869 = v868 - v801;
+  uint64_t v870 = v213 - v861;
+  uint64_t v871 = v870 + v505;
+  uint64_t v872 = v802 + v814;
+  uint64_t v873 = v309 + v519;
+  uint64_t v874 = v519 - v309;
+  uint64_t v875 = v802 - v814;
+  uint64_t v876 = v225 + v872;
+  uint64_t v877 = v227 - v873;
+  uint64_t v878 = v225 - v874;
+  uint64_t v879 = v878 - v814;
+  uint64_t v880 = v227 + v875;
+  uint64_t v881 = v880 + v309;
+  uint64_t v882 = v225 + v874;
+  uint64_t v883 = v882 - v802;
+  uint64_t v884 = v227 - v875;
+  uint64_t v885 = v884 + v519;
+  uint64_t v886 = v803 + v815;
+  uint64_t v887 = v323 + v533;
+  uint64_t v888 = v533 - v323;
+  uint64_t v889 = v803 - v815;
+  uint64_t v890 = v239 + v886;
+  uint64_t v891 = v241 - v887;
+  uint64_t v892 = v239 - v888;
+  uint64_t v893 = v892 - v815;
+  uint64_t v894 = v241 + v889;
+  uint64_t v895 = v894 + v323;
+  uint64_t v896 = v239 + v888;
+  uint64_t v897 = v896 - v803;
+  uint64_t v898 = v241 - v889;
+  uint64_t v899 = v898 + v533;
+  uint64_t v900 = v804 - v423;
+  uint64_t v901 = v807 - v337;
+  uint64_t v902 = v337 + v807;
+  uint64_t v903 = v804 + v423;
+  uint64_t v904 = v253 + v900;
+  uint64_t v905 = v255 + v901;
+  uint64_t v906 = v253 + v902;
+  uint64_t v907 = v906 + v423;
+  uint64_t v908 = v255 + v903;
+  uint64_t v909 = v908 + v337;
+  uint64_t v910 = v253 - v902;
+  uint64_t v911 = v910 - v804;
+  uint64_t v912 = v255 - v903;
+  uint64_t v913 = v912 - v807;
+  uint64_t v914 = v805 - v437;
+  uint64_t v915 = v808 - v351;
+  uint64_t v916 = v351 + v808;
+  uint64_t v917 = v805 + v437;
+  uint64_t v918 = v267 + v914;
+  uint64_t v919 = v269 + v915;
+  uint64_t v920 = v267 + v916;
+  uint64_t v921 = v920 + v437;
+  uint64_t v922 = v269 + v917;
+  uint64_t v923 = v922 + v351;
+  uint64_t v924 = v267 - v916;
+  uint64_t v925 = v924 - v805;
+  uint64_t v926 = v269 - v917;
+  uint64_t v927 = v926 - v808;
+  uint64_t v928 = v806 - v451;
+  uint64_t v929 = v809 - v365;
+  uint64_t v930 = v365 + v809;
+  uint64_t v931 = v806 + v451;
+  uint64_t v932 = v281 + v928;
+  uint64_t v933 = v283 + v929;
+  uint64_t v934 = v281 + v930;
+  uint64_t v935 = v934 + v451;
+  uint64_t v936 = v283 + v931;
+  uint64_t v937 = v936 + v365;
+  uint64_t v938 = v281 - v930;
+  uint64_t v939 = v938 - v806;
+  uint64_t v940 = v283 - v931;
+  uint64_t v941 = v940 - v809;
+  p[0] = T(v544, v545);
+  p[1] = T(v558, v559);
+  p[2] = T(v572, v573);
+  p[3] = T(v586, v587);
+  p[4] = T(v600, v601);
+  p[5] = T(v614, v615);
+  p[6] = T(v628, v629);
+  p[7] = T(v642, v643);
+  p[8] = T(v656, v657);
+  p[9] = T(v679, v680);
+  p[10] = T(v693, v694);
+  p[11] = T(v707, v708);
+  p[12] = T(v721, v722);
+  p[13] = T(v735, v736);
+  p[14] = T(v749, v750);
+  p[15] = T(v763, v764);
+  p[16] = T(v777, v778);
+  p[17] = T(v791, v792);
+  p[18] = T(v820, v821);
+  p[19] = T(v834, v835);
+  p[20] = T(v848, v849);
+  p[21] = T(v862, v863);
+  p[22] = T(v876, v877);
+  p[23] = T(v890, v891);
+  p[24] = T(v904, v905);
+  p[25] = T(v918, v919);
+  p[26] = T(v932, v933);
+  p[27] = T(v551, v553);
+  p[28] = T(v565, v567);
+  p[29] = T(v579, v581);
+  p[30] = T(v593, v595);
+  p[31] = T(v607, v609);
+  p[32] = T(v621, v623);
+  p[33] = T(v635, v637);
+  p[34] = T(v649, v651);
+  p[35] = T(v663, v665);
+  p[36] = T(v686, v688);
+  p[37] = T(v700, v702);
+  p[38] = T(v714, v716);
+  p[39] = T(v728, v730);
+  p[40] = T(v742, v744);
+  p[41] = T(v756, v758);
+  p[42] = T(v770, v772);
+  p[43] = T(v784, v786);
+  p[44] = T(v798, v800);
+  p[45] = T(v827, v829);
+  p[46] = T(v841, v843);
+  p[47] = T(v855, v857);
+  p[48] = T(v869, v871);
+  p[49] = T(v883, v885);
+  p[50] = T(v897, v899);
+  p[51] = T(v911, v913);
+  p[52] = T(v925, v927);
+  p[53] = T(v939, v941);
+  p[54] = T(v547, v549);
+  p[55] = T(v561, v563);
+  p[56] = T(v575, v577);
+  p[57] = T(v589, v591);
+  p[58] = T(v603, v605);
+  p[59] = T(v617, v619);
+  p[60] = T(v631, v633);
+  p[61] = T(v645, v647);
+  p[62] = T(v659, v661);
+  p[63] = T(v682, v684);
+  p[64] = T(v696, v698);
+  p[65] = T(v710, v712);
+  p[66] = T(v724, v726);
+  p[67] = T(v738, v740);
+  p[68] = T(v752, v754);
+  p[69] = T(v766, v768);
+  p[70] = T(v780, v782);
+  p[71] = T(v794, v796);
+  p[72] = T(v823, v825);
+  p[73] = T(v837, v839);
+  p[74] = T(v851, v853);
+  p[75] = T(v865, v867);
+  p[76] = T(v879, v881);
+  p[77] = T(v893, v895);
+  p[78] = T(v907, v909);
+  p[79] = T(v921, v923);
+  p[80] = T(v935, v937);
+}
+
+// Runs fftdif(p, m, r) and returns true if there is a codelet for m and r.
+inline bool codelet_fftdif(T *p, uint64_t m, uint64_t r) {
+  if (m == 9 && r == 3) {
+    fftdif_9_3(p);
+    return true;
+  }
+  if (m == 9 && r == 9) {
+    fftdif_9_9(p);
+    return true;
+  }
+  return false;
+}
+
+// Runs fftdit(p, m, r) and returns true if there is a codelet for m and r.
+inline bool codelet_fftdit(T *p, uint64_t m, uint64_t r) {
+  if (m == 9 && r == 3) {
+    fftdit_9_3(p);
+    return true;
+  }
+  if (m == 9 && r == 9) {
+    fftdit_9_9(p);
+    return true;
+  }
+  return false;
+}
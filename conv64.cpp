@@ -6,8 +6,36 @@
  *
  */
 
+#include<arpa/inet.h>
+#include<linux/io_uring.h>
+#include<fcntl.h>
+#include<netinet/in.h>
+#include<sys/mman.h>
+#include<sys/socket.h>
+#include<sys/stat.h>
+#include<sys/syscall.h>
+#include<unistd.h>
+
+#include<algorithm>
+#include<cerrno>
+#include<cstring>
+#include<atomic>
+#include<chrono>
+#include<condition_variable>
+#include<exception>
+#include<fstream>
+#include<functional>
+#include<iomanip>
 #include<iostream>
+#include<limits>
+#include<map>
+#include<mutex>
+#include<random>
+#include<stdexcept>
+#include<string>
+#include<thread>
 #include<vector>
+#include<type_traits>
 
 using namespace std;
 
@@ -88,254 +116,2115 @@ void operator*=(T &u, const T &v) {
   u.b=u.b*v.a + tmp*v.b - u.b*v.b;
 }
 
-// We pack the main algorithm in a class of its own, mainly because we will have
-// to allocate some temporary working memory.
-class Conv64 {
+/*
+ * Straight-line versions of fftdif and fftdit for the small shapes met inside
+ * mul, generated by gen_codelets.cpp.
+ */
+
+#include "codelets.h"
+
+/*
+ * An optional recorder of where the time goes, written out as Chrome trace
+ * events (the JSON read by chrome://tracing and Perfetto). Every span carries
+ * the length n it works on, the recursion depth of mul, the index of the
+ * block or task it belongs to, and the thread that ran it. Only the phases of
+ * a product and the calls of mul above the grade-school size are recorded,
+ * so the leaves, which are the bulk of the calls, cost nothing.
+ *
+ * To stay on in long-running processes, a trace keeps at most `capacity`
+ * spans, the oldest being overwritten first, and can be drained
+ * periodically. Spans of mul deeper than `max_depth` are not recorded at all,
+ * which also skips their clock reads and locking.
+ */
+class Trace {
   public:
 
-  // Returns the product of two polynomials from the ring R[x].
-  vector<int64_t> multiply(const vector<int64_t> &p,
-                           const vector<int64_t> &q) {
-    vector<uint64_t> pp(p.size()), qq(q.size());
-    for (uint64_t i = 0; i < p.size(); ++i) {
-      pp[i] = p[i];
-    }
-    for (uint64_t i = 0; i < q.size(); ++i) {
-      qq[i] = q[i];
+  // Records the time between its construction and destruction, if trace is
+  // not null.
+  class Span {
+    public:
+
+    Span(Trace *trace, const char *name, uint64_t n, uint64_t depth = 0,
+         uint64_t block = 0)
+        : trace(trace), name(name), n(n), depth(depth), block(block) {
+      if (trace && depth > trace->max_depth) {
+        this->trace = nullptr;
+      }
+      if (this->trace) {
+        start = chrono::steady_clock::now();
+      }
     }
-    uint64_t s = 1;
-    while (s < p.size() + q.size() - 1) {
-      s *= 3;
+
+    ~Span() {
+      if (trace) {
+        trace->add(*this, chrono::steady_clock::now());
+      }
     }
-    pp.resize(s);
-    qq.resize(s);
-    vector<int64_t> res(s);
-    multiply_cyclic_raw(pp.data(), qq.data(), pp.size(), (uint64_t*)res.data());
-    res.resize(p.size() + q.size() - 1);
-    return res;
+
+    private:
+    friend class Trace;
+    Trace *trace;
+    const char *name;
+    uint64_t n, depth, block;
+    chrono::steady_clock::time_point start;
+  };
+
+  explicit Trace(uint64_t capacity = 1 << 16, uint64_t max_depth = ~0ull)
+      : capacity(max<uint64_t>(capacity, 1)), max_depth(max_depth),
+        origin(chrono::steady_clock::now()) { }
+
+  // Writes the spans kept so far, oldest first, with times in microseconds
+  // since the trace was created.
+  void write(ostream &out) {
+    lock_guard<mutex> guard(lock);
+    print(out);
+  }
+
+  // Writes the spans kept so far as write does, and forgets them.
+  void drain(ostream &out) {
+    lock_guard<mutex> guard(lock);
+    print(out);
+    events.clear();
+    recorded = 0;
+  }
+
+  // The number of spans overwritten since the last drain.
+  uint64_t dropped() {
+    lock_guard<mutex> guard(lock);
+    return recorded - events.size();
   }
 
   private:
 
-  // Temporary space.
-  T *tmp;
+  struct Event {
+    const char *name;
+    uint64_t n, depth, block, thread;
+    double start, duration;
+  };
 
-  // Returns the product of a polynomial and the monomial x^t in the ring
-  // T[x]/(x^m - omega). The result is placed in `to`.
-  // NOTE: t must be in the range [0,3m]
-  void twiddle(T *p, uint64_t m, uint64_t t, T *to) {
-    if (t == 0 || t == 3*m) {
-      for (uint64_t j = 0; j < m; ++j) {
-        to[j] = p[j];
-      }
-      return;
+  // write, with the lock held.
+  void print(ostream &out) {
+    out << fixed << setprecision(3) << "{\"traceEvents\":[";
+    uint64_t first = recorded > capacity ? recorded % capacity : 0;
+    for (uint64_t i = 0; i < events.size(); ++i) {
+      const Event &e = events[(first + i) % events.size()];
+      out << (i ? ",\n" : "\n") << "{\"name\":\"" << e.name
+          << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.thread
+          << ",\"ts\":" << e.start << ",\"dur\":" << e.duration
+          << ",\"args\":{\"n\":" << e.n << ",\"depth\":" << e.depth
+          << ",\"block\":" << e.block << "}}";
     }
-    uint64_t tt;
-    T mult = 1;
-    if (t < m) {
-      tt = t;
-    } else if (t < 2*m) {
-      tt = t - m;
-      mult = OMEGA;
+    out << "\n]}\n";
+  }
+
+  void add(const Span &s, chrono::steady_clock::time_point end) {
+    double start = chrono::duration<double, micro>(s.start - origin).count();
+    double duration = chrono::duration<double, micro>(end - s.start).count();
+    lock_guard<mutex> guard(lock);
+    uint64_t id = find(threads.begin(), threads.end(), this_thread::get_id()) -
+                  threads.begin();
+    if (id == threads.size()) {
+      threads.push_back(this_thread::get_id());
+    }
+    Event e = {s.name, s.n, s.depth, s.block, id, start, duration};
+    if (events.size() < capacity) {
+      events.push_back(e);
     } else {
-      tt = t - 2*m;
-      mult = OMEGA2;
+      events[recorded % capacity] = e;
     }
-    for (uint64_t j=0;j<tt;j++) {
-      to[j] = p[m - tt + j]*OMEGA*mult;
+    ++recorded;
+  }
+
+  mutex lock;
+  uint64_t capacity, max_depth;
+  chrono::steady_clock::time_point origin;
+  // A ring of the last `capacity` spans, and the number of spans added to
+  // it.
+  vector<Event> events;
+  uint64_t recorded = 0;
+  // Threads are numbered in the order of their first span.
+  vector<thread::id> threads;
+};
+
+/*
+ * An optional log of the calls an engine is asked for, so benchmarks can be
+ * run on the shapes seen in production rather than synthetic ones. Each call
+ * is stored as a 48 byte record of the entry point, up to three arguments
+ * that are not operands (the window of multiply_range, the n of a
+ * transform, the shapes of a matrix product), the time the call took and
+ * the number of operands, followed by a 24 byte record per operand of its
+ * length, its number of nonzero coefficients and the bits needed to hold
+ * its largest coefficient as a signed number. The operands themselves are
+ * not stored. Records are in the native byte order, after an 8 byte header
+ * that names the format. Logs of the first format, with two operands per
+ * call and only multiply and multiply_add, can still be read.
+ *
+ * Every public entry point of an engine is logged once per call, as itself:
+ * the calls it makes internally, on the same engine or on the engines of
+ * its parallel tasks, are not logged.
+ */
+class Recorder {
+  public:
+
+  enum Entry : uint8_t {
+    MULTIPLY,
+    MULTIPLY_ADD,
+    MULTIPLY_T,
+    MULTIPLY_RANGE,
+    MULTIPLY_EXACT,
+    MULTIPLY_MANY,
+    MULTIPLY_BATCH,
+    MULTIPLY_MATRIX,
+    TRANSFORM,
+    MULTIPLY_ADD_SPECTRA,
+    INVERSE,
+    MULTIPLY_CYCLIC
+  };
+
+  struct Operand {
+    uint64_t len, nonzero;
+    uint8_t bits;
+  };
+
+  struct Call {
+    Entry entry;
+    uint64_t args[3];
+    double seconds;
+    vector<Operand> operands;
+  };
+
+  // Records the time between its construction and destruction as a call,
+  // if recorder is not null and the call does not throw. The operands and arguments of the call are
+  // added with operand and arg; describing an operand is not timed. While
+  // it exists, the engine's recorder, passed by reference, is null, so the
+  // calls the entry point makes itself are not logged.
+  class Scope {
+    public:
+
+    Scope(Recorder *&engine, Entry entry)
+        : engine(engine), recorder(engine), exceptions(uncaught_exceptions()) {
+      engine = nullptr;
+      if (recorder) {
+        call.entry = entry;
+        fill(call.args, call.args + 3, 0);
+        start = chrono::steady_clock::now();
+      }
     }
-    for (uint64_t j=tt;j<m;j++) {
-      to[j] = p[j-tt]*mult;
+
+    template<class I, class J>
+    Scope(Recorder *&engine, Entry entry, const vector<I> &p,
+          const vector<J> &q) : Scope(engine, entry) {
+      operand(p);
+      operand(q);
     }
-  }
 
-  // A "Decimation In Frequency" In-Place Radix-3 FFT Routine.
-  // Input: A polynomial from (T[x]/(x^m - omega))[y]/(y^r - 1).
-  // Output: Its Fourier transform (w.r.t. y) in 3-reversed order.
-  void fftdif(T *p, uint64_t m, uint64_t r) {
-    if (r == 1) return;
-    uint64_t rr = r/3;
-    uint64_t pos1 = m*rr, pos2 = 2*m*rr;
-    for (uint64_t i = 0; i < rr; ++i) {
-      for (uint64_t j = 0; j < m; ++j) {
-        tmp[j] = p[i*m + j] + p[pos1 + i*m + j] + p[pos2 + i*m + j];
-        tmp[m + j] = p[i*m + j] + OMEGA*p[pos1 + i*m + j] + OMEGA2*p[pos2 + i*m + j];
-        tmp[2*m + j] = p[i*m + j] + OMEGA2*p[pos1 + i*m + j] + OMEGA*p[pos2 + i*m + j];
-        p[i*m + j] = tmp[j];
+    ~Scope() {
+      engine = recorder;
+      if (recorder && uncaught_exceptions() == exceptions) {
+        call.seconds = chrono::duration<double>(chrono::steady_clock::now() -
+                                                start).count();
+        recorder->add(call);
       }
-      twiddle(tmp + m, m, 3*i*m/r, p + pos1 + i*m);
-      twiddle(tmp + 2*m, m, 6*i*m/r, p + pos2 + i*m);
     }
-    fftdif(p, m, rr);
-    fftdif(p + pos1, m, rr);
-    fftdif(p + pos2, m, rr);
-  }
 
-  // A "Decimation In Time" In-Place Radix-3 Inverse FFT Routine.
-  // Input: A polynomial in (T[x]/(x^m - omega))[y]/(y^r - 1) with coefficients
-  //        in 3-reversed order.
-  // Output: Its inverse Fourier transform in normal order.
-  void fftdit(T *p, uint64_t m, uint64_t r) {
-    if (r == 1) return;
-    uint64_t rr = r/3;
-    uint64_t pos1 = m*rr, pos2 = 2*m*rr;
-    fftdit(p, m, rr);
-    fftdit(p + pos1, m, rr);
-    fftdit(p + pos2, m, rr);
-    for (uint64_t i = 0; i < rr; ++i) {
-      twiddle(p + pos1 + i*m, m, 3*m - 3*i*m/r, tmp + m);
-      twiddle(p + pos2 + i*m, m, 3*m - 6*i*m/r, tmp + 2*m);
-      for(uint64_t j = 0; j < m; ++j) {
-        tmp[j] = p[i*m + j];
-        p[i*m + j] = tmp[j] + tmp[m + j] + tmp[2*m + j];
-        p[i*m + pos1 + j] = tmp[j] + OMEGA2*tmp[m + j] + OMEGA*tmp[2*m + j];
-        p[i*m + pos2 + j] = tmp[j] + OMEGA*tmp[m + j] + OMEGA2*tmp[2*m + j];
+    Scope(const Scope&) = delete;
+    Scope &operator=(const Scope&) = delete;
+
+    template<class I>
+    void operand(const vector<I> &p) {
+      if (recorder) {
+        call.operands.push_back(describe(p));
+        start = chrono::steady_clock::now();
       }
     }
+
+    void arg(uint64_t i, uint64_t value) {
+      call.args[i] = value;
+    }
+
+    private:
+    Recorder *&engine;
+    Recorder *recorder;
+    int exceptions;
+    Call call;
+    chrono::steady_clock::time_point start;
+  };
+
+  // Starts a new log in the given file.
+  explicit Recorder(const string &file) : out(file, ios::binary) {
+    out.write(MAGIC, 8);
+    if (!out) {
+      throw runtime_error("cannot write " + file);
+    }
   }
 
-  // Computes the product of two polynomials in T[x]/(x^n - omega), where n is
-  // a power of 3. The result is placed in `to`.
-  void mul(T *p, T *q, uint64_t n, T *to) {
-    if (n <= 27) {
-      // O(n^2) grade-school multiplication
-      for (uint64_t i = 0; i < n; ++i) {
-        to[i]=0;
+  void add(const Call &c) {
+    vector<char> rec(48 + 24*c.operands.size());
+    uint32_t count = c.operands.size();
+    rec[0] = c.entry;
+    memcpy(&rec[4], &count, 4);
+    memcpy(&rec[8], c.args, 24);
+    memcpy(&rec[32], &c.seconds, 8);
+    for (uint64_t i = 0; i < count; ++i) {
+      const Operand &o = c.operands[i];
+      uint64_t bits = o.bits;
+      memcpy(&rec[48 + 24*i], &o.len, 8);
+      memcpy(&rec[56 + 24*i], &o.nonzero, 8);
+      memcpy(&rec[64 + 24*i], &bits, 8);
+    }
+    lock_guard<mutex> guard(lock);
+    out.write(rec.data(), rec.size());
+    out.flush();
+  }
+
+  // Returns the calls in the log in the given file.
+  static vector<Call> read(const string &file) {
+    ifstream in(file, ios::binary);
+    char rec[48];
+    if (!in.read(rec, 8) ||
+        (memcmp(rec, MAGIC, 8) != 0 && memcmp(rec, MAGIC1, 8) != 0)) {
+      throw runtime_error(file + " is not a conv64 workload log");
+    }
+    bool first = memcmp(rec, MAGIC1, 8) == 0;
+    vector<Call> calls;
+    while (in.read(rec, 48)) {
+      Call c;
+      c.entry = (Entry)rec[0];
+      fill(c.args, c.args + 3, 0);
+      if (first) {
+        uint64_t w[5];
+        memcpy(w, rec + 8, 32);
+        memcpy(&c.seconds, rec + 40, 8);
+        c.operands = {{w[0], w[2], (uint8_t)rec[1]}, {w[1], w[3], (uint8_t)rec[2]}};
+        calls.push_back(c);
+        continue;
       }
-      for (uint64_t i = 0; i < n; ++i) {
-        for (uint64_t j = 0; j < n - i; ++j) {
-          to[i + j] += p[i]*q[j];
-        }
-        for (uint64_t j = n - i; j < n; ++j) {
-          to[i + j - n] += p[i]*q[j]*OMEGA;
+      uint32_t count;
+      memcpy(&count, rec + 4, 4);
+      memcpy(c.args, rec + 8, 24);
+      memcpy(&c.seconds, rec + 32, 8);
+      for (uint32_t i = 0; i < count; ++i) {
+        uint64_t w[3];
+        if (!in.read((char*)w, 24)) {
+          throw runtime_error(file + " ends in the middle of a call");
         }
+        c.operands.push_back({w[0], w[1], (uint8_t)w[2]});
       }
-      return;
+      calls.push_back(c);
     }
+    return calls;
+  }
 
-    uint64_t m = 1;
-    while (m*m < n) {
-      m *= 3;
+  // Returns random coefficients matching the length, the number of nonzero
+  // coefficients and the bit width of an operand.
+  static vector<int64_t> generate(const Operand &o, mt19937_64 &rng) {
+    uint64_t len = o.len, nonzero = o.nonzero;
+    vector<int64_t> p(len);
+    for (uint64_t i = 0; i < len; ++i) {
+      // Of the len - i positions left, nonzero should get a coefficient.
+      if (rng() % (len - i) >= nonzero) {
+        continue;
+      }
+      --nonzero;
+      while (p[i] == 0) {
+        p[i] = (int64_t)rng() >> (64 - max<int>(o.bits, 1));
+      }
     }
-    uint64_t r = n/m;
+    return p;
+  }
 
-    T inv = 1;
-    for (uint64_t i = 1; i < r; i *= 3) {
-      inv *= INV3;
+  private:
+
+  static constexpr const char *MAGIC = "conv64w2";
+  // The first format, with fixed 48 byte records of two operands.
+  static constexpr const char *MAGIC1 = "conv64w1";
+
+  // Bits above the sign needed by a coefficient, for OR-ing together.
+  template<class I>
+  static uint64_t magnitude(const I &c) {
+    int64_t v = (int64_t)c;
+    return v ^ (v >> 63);
+  }
+
+  static uint64_t magnitude(const T &c) {
+    return magnitude((int64_t)c.a) | magnitude((int64_t)c.b);
+  }
+
+  template<class I>
+  static bool is_nonzero(const I &c) {
+    return (int64_t)c != 0;
+  }
+
+  static bool is_nonzero(const T &c) {
+    return c.a || c.b;
+  }
+
+  template<class I>
+  static Operand describe(const vector<I> &p) {
+    Operand o = {p.size(), 0, 0};
+    uint64_t any = 0;
+    for (const I &c : p) {
+      o.nonzero += is_nonzero(c);
+      any |= magnitude(c);
     }
+    o.bits = any ? 65 - __builtin_clzll(any) : o.nonzero ? 1 : 0;
+    return o;
+  }
 
-    /**********************************************************
-     * THE PRODUCT IN (T[x]/(x^m - omega))[y] / (y^r - omega) *
-     **********************************************************/
+  mutex lock;
+  ofstream out;
+};
 
-    // Move to the ring (T[x]/(x^m - omega))[y]/(y^r - 1) via the map y -> x^(m/r) y
-    for (uint64_t i = 0; i < r; ++i) {
-      twiddle(p + m*i, m, m/r*i, to + m*i);
-      twiddle(q + m*i, m, m/r*i, to + n + m*i);
+/*
+ * A pool of threads shared by several engines, which runs their parallel
+ * tasks by priority. A task is never interrupted, but engines attached to a
+ * scheduler check for waiting tasks of a higher priority at the natural
+ * boundaries of a product (between levels of the transforms and between the
+ * block products) and run them first, on the same thread. So a small urgent
+ * product gets a core promptly even when a large one holds them all, while
+ * the large one still gets every core that is idle.
+ */
+class Scheduler {
+  public:
+
+  explicit Scheduler(unsigned threads = max(1u, thread::hardware_concurrency())) {
+    for (unsigned t = 0; t < threads; ++t) {
+      workers.emplace_back([this]() { work(); });
     }
+  }
 
-    // Multiply using FFT
-    fftdif(to, m, r);
-    fftdif(to + n, m, r);
-    for (uint64_t i = 0; i < r; ++i) {
-      mul(to + m*i, to + n + m*i, m, to +2*n + m*i);
+  ~Scheduler() {
+    {
+      lock_guard<mutex> guard(lock);
+      stopping = true;
     }
-    fftdit(to + 2*n, m, r);
-    for (uint64_t i = 0; i < n; ++i) {
-      to[2*n + i] *= inv;
+    wake.notify_all();
+    for (thread &t : workers) {
+      t.join();
     }
+  }
 
-    // Return to the ring (T[x]/(x^m - omega))[y]/(y^r - omega)
-    for (uint64_t i = 0; i < r; ++i) {
-      twiddle(to + 2*n + m*i, m, 3*m - m/r*i, to + n + m*i);
+  // Runs f(i) for i = 0, ..., count - 1 as tasks of the given priority,
+  // higher priorities running first and equal ones in order of submission,
+  // and returns once all are done. The calling thread takes part. If a task
+  // throws, the first exception is rethrown here once the others are done.
+  void run(uint64_t count, int priority, const function<void(uint64_t)> &f) {
+    if (count == 0) return;
+    Job job = {priority, 0, count, 0, 0, &f, nullptr};
+    {
+      lock_guard<mutex> guard(lock);
+      job.seq = seq++;
+      queue.push_back(&job);
+      update_top();
     }
+    wake.notify_all();
+    while (step(&job, 0)) { }
+    unique_lock<mutex> guard(lock);
+    done.wait(guard, [&]() { return job.finished == job.count; });
+    if (job.error) {
+      rethrow_exception(job.error);
+    }
+  }
 
-    /************************************************************
-     * THE PRODUCT IN (T[x]/(x^m - omega^2))[y] / (y^r - omega) *
-     ************************************************************/
+  // Runs waiting tasks of a priority above the given one, if there are any.
+  void yield(int priority) {
+    while (top.load(memory_order_relaxed) > priority &&
+           step(nullptr, (int64_t)priority + 1)) { }
+  }
 
-    // Use conjugation to move to the ring (T[x]/(x^m - omega))[y]/(y^r - omega^2).
-    // Then move to (T[x]/(x^m - omega))[y]/(y^r - 1) via the map y -> x^(2m/r) y
-    for (uint64_t i = 0; i < r; ++i) {
-      for (uint64_t j = 0; j < m; ++j) {
-        p[m*i + j] = p[m*i + j].conj();
-        q[m*i + j] = q[m*i + j].conj();
+  private:
+
+  struct Job {
+    int priority;
+    uint64_t seq, count, next, finished;
+    const function<void(uint64_t)> *f;
+    exception_ptr error;
+  };
+
+  // Runs one task of `job`, or if it is null, of the first job in priority
+  // order whose priority is at least `least`. Returns whether there was one.
+  bool step(Job *job, int64_t least) {
+    uint64_t i;
+    {
+      lock_guard<mutex> guard(lock);
+      if (!job) {
+        for (Job *j : queue) {
+          if (!job || j->priority > job->priority ||
+              (j->priority == job->priority && j->seq < job->seq)) {
+            job = j;
+          }
+        }
+        if (!job || job->priority < least) return false;
+      }
+      if (job->next == job->count) return false;
+      i = job->next++;
+      if (job->next == job->count) {
+        queue.erase(find(queue.begin(), queue.end(), job));
+        update_top();
       }
-      twiddle(p + m*i, m, 2*m/r*i, to + m*i);
-      twiddle(q + m*i, m, 2*m/r*i, p + m*i);
     }
-
-    fftdif(to, m, r);
-    fftdif(p, m, r);
-    for (uint64_t i = 0; i < r; ++i) {
-      mul(to + m*i, p + m*i, m, to + 2*n + m*i);
+    exception_ptr error;
+    try {
+      (*job->f)(i);
+    } catch (...) {
+      error = current_exception();
     }
-    fftdit(to + 2*n, m, r);
-    for (uint64_t i = 0; i < n; ++i) {
-      to[2*n + i] *= inv;
+    lock_guard<mutex> guard(lock);
+    if (error && !job->error) {
+      job->error = error;
     }
-
-    for (uint64_t i = 0; i < r; ++i) {
-      twiddle(to + 2*n + m*i, m, 3*m - 2*m/r*i, q + m*i);
+    if (++job->finished == job->count) {
+      done.notify_all();
     }
+    return true;
+  }
 
-    /**************************************************************************
-     * The product in (T[x]/(x^(2m) + x^m + 1))[y]/(y^r - omega) via CRT, and *
-     * unravelling the substitution y = x^m at the same time.                 *
-     **************************************************************************/
-
-    for (uint64_t i = 0; i < n; ++i) {
-      to[i] = 0;
-    }
-    for (uint64_t i = 0; i < r; ++i) {
-      for (uint64_t j = 0; j < m; ++j) {
-        to[i*m + j] += (1 - OMEGA)*to[n + i*m + j] + (1 - OMEGA2)*q[i*m + j].conj();
-        if (i*m + m + j < n) {
-          to[i*m + m + j] += (OMEGA2 - OMEGA)*(to[n + i*m + j] - q[i*m + j].conj());
-        } else {
-          to[i*m + m + j - n] += (1 - OMEGA2)*(to[n + i*m + j] - q[i*m + j].conj());
-        }
+  void work() {
+    for (;;) {
+      {
+        unique_lock<mutex> guard(lock);
+        wake.wait(guard, [&]() { return stopping || !queue.empty(); });
+        if (queue.empty()) return;
       }
+      step(nullptr, numeric_limits<int64_t>::min());
     }
-    for (uint64_t i = 0; i < n; ++i) {
-      to[i] *= INV3;
+  }
+
+  // Must be called with the lock held.
+  void update_top() {
+    int64_t t = numeric_limits<int64_t>::min();
+    for (Job *j : queue) {
+      t = max<int64_t>(t, j->priority);
     }
+    top.store(t, memory_order_relaxed);
   }
 
-  // Computes the product of two polynomials from the ring R[x]/(x^n - 1), where
-  // n must be a power of three. The result is placed in target which must have
-  // space for n elements.
-  void multiply_cyclic_raw(uint64_t *p, uint64_t *q, uint64_t n,
-                                       uint64_t *target) {
-    // If n = 3^k, let m = 3^(floor(k/2)) and r = 3^(ceil(k/2))
-    uint64_t m = 1;
-    while (m*m <= n) {
-      m *= 3;
+  mutex lock;
+  condition_variable wake, done;
+  // The jobs with tasks not yet started.
+  vector<Job*> queue;
+  // The highest priority in the queue, read without the lock by yield.
+  atomic<int64_t> top{numeric_limits<int64_t>::min()};
+  uint64_t seq = 0;
+  bool stopping = false;
+  vector<thread> workers;
+};
+
+// We pack the main algorithm in a class of its own, mainly because we will have
+// to allocate some temporary working memory.
+class Conv64 {
+  friend class Distributed;
+
+  public:
+
+  // Records the phases of the following products in trace, or stops
+  // recording if it is null. The trace must outlive the products.
+  void set_trace(Trace *t) {
+    trace = t;
+  }
+
+  // Runs the parallel parts of the following calls on the scheduler's
+  // threads at the given priority, and lets tasks of a higher priority
+  // run at the yield points of this engine's products. Without a scheduler,
+  // each call starts threads of its own.
+  void set_scheduler(Scheduler *s, int p = 0) {
+    scheduler = s;
+    priority = p;
+  }
+
+  // Logs the following calls of this engine's public entry points to
+  // recorder, or stops logging if it is null.
+  void set_recorder(Recorder *r) {
+    recorder = r;
+  }
+
+  // Returns the product of two polynomials from the ring R[x]. The
+  // coefficients can be of any integer type, and are only widened to 64 bits
+  // (sign extended for signed types) as the first transform level reads them.
+  template<class I, class J>
+  vector<int64_t> multiply(const vector<I> &p, const vector<J> &q) {
+    static_assert(is_integral<I>::value && is_integral<J>::value,
+                  "coefficients must be integers");
+    Recorder::Scope scope(recorder, Recorder::MULTIPLY, p, q);
+    uint64_t len = p.size() + q.size() - 1;
+    Plan plan = planned(p.size(), q.size(), len*sizeof(int64_t));
+    vector<int64_t> res(len);
+    multiply_linear(p.data(), p.size(), q.data(), q.size(),
+                    (uint64_t*)res.data(), false, plan);
+    if (repetitions && !verify(p, q, res, repetitions)) {
+      throw runtime_error("multiply: the product failed verification");
     }
-    m /= 3;
-    uint64_t r = n/m;
+    return res;
+  }
 
-    // Compute 3^(-r)
-    T inv = 1;
-    for (uint64_t i = 1; i < r; i *= 3) {
-      inv *= INV3;
+  // Returns the product of two polynomials from the ring T[x]. This is a
+  // single product in T[x]/(x^n - omega) by mul, with n the smallest power
+  // of three that the product fits in, which costs about as much as two
+  // products over R of the same length rather than the four of splitting
+  // into components.
+  vector<T> multiply_T(const vector<T> &p, const vector<T> &q) {
+    Recorder::Scope scope(recorder, Recorder::MULTIPLY_T, p, q);
+    if (p.empty() || q.empty()) {
+      return {};
+    }
+    uint64_t len = p.size() + q.size() - 1;
+    uint64_t n = 1;
+    while (n < len) {
+      n *= 3;
     }
 
-    // Allocate some working memory, the layout is as follows:
     // pp: length n
     // qq: length n
-    // to: length n + 3*m
-    // tmp: length 3*m
-    T *buf = new T[3*n + 6*m];
-    T *pp = buf;
-    T *qq = buf + n;
-    T *to = buf + 2*n;
-    tmp = buf + 3*n + 3*m;
+    // to: length mul_size(n)
+    // tmp: length 4*block_size(n)
+    T *buf = new T[2*n + mul_size(n) + 4*block_size(n)];
+    T *pp = buf, *qq = buf + n, *to = buf + 2*n;
+    tmp = to + mul_size(n);
+    Trace::Span span(trace, "multiply_T", n);
+    out = nullptr;
+    copy(p.begin(), p.end(), pp);
+    fill(pp + p.size(), pp + n, T());
+    copy(q.begin(), q.end(), qq);
+    fill(qq + q.size(), qq + n, T());
+    mul(pp, qq, n, to);
+    vector<T> res(to, to + len);
+    delete[] buf;
+    return res;
+  }
 
-    for (uint64_t i = 0; i < n; ++i) {
-      pp[i] = p[i];
-      qq[i] = q[i];
-    }
+  // Makes multiply check each product with verify, throwing a runtime_error
+  // if the check fails. 0 turns the check off.
+  void set_verification(unsigned r) {
+    repetitions = r;
+  }
+
+  // Checks that res is the product of p and q by evaluating both sides at
+  // random points: an odd integer and an element of T per repetition. An
+  // error in the low bits of a coefficient is caught almost surely. Errors
+  // confined to the top bits can vanish at every integer, like
+  // 2^63 (x^2 - x), which is what the points in T are for, but may still
+  // pass a repetition about half of the time, so use more repetitions where
+  // such errors matter. A repetition reads every coefficient once, which
+  // costs about 1% of a product.
+  template<class I, class J>
+  bool verify(const vector<I> &p, const vector<J> &q,
+              const vector<int64_t> &res, unsigned repetitions = 2) {
+    if (p.empty() || q.empty()) {
+      return all_of(res.begin(), res.end(), [](int64_t c) { return c == 0; });
+    }
+    if (res.size() != p.size() + q.size() - 1) {
+      return false;
+    }
+    random_device seed;
+    mt19937_64 rng(((uint64_t)seed() << 32) ^ seed());
+    for (unsigned i = 0; i < repetitions; ++i) {
+      uint64_t x = rng() | 1;
+      if (evaluate(p, x)*evaluate(q, x) != evaluate(res, x)) {
+        return false;
+      }
+      T y(rng(), rng());
+      T u = evaluate(p, y)*evaluate(q, y), v = evaluate(res, y);
+      if (u.a != v.a || u.b != v.b) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Adds the product of p and q to acc, which must have room for
+  // p.size() + q.size() - 1 coefficients. The product is added in by the
+  // final pass of the cyclic product, so no vector is allocated for it.
+  template<class I, class J>
+  void multiply_add(const vector<I> &p, const vector<J> &q, int64_t *acc) {
+    Recorder::Scope scope(recorder, Recorder::MULTIPLY_ADD, p, q);
+    multiply_linear(p.data(), p.size(), q.data(), q.size(), (uint64_t*)acc,
+                    true, planned(p.size(), q.size(), 0));
+  }
+
+  // Limits the memory multiply and multiply_add allocate, including the
+  // result of multiply, to the given number of bytes, 0 meaning no limit.
+  // Products whose workspace does not fit are cut into pieces that do, and
+  // products that cannot fit at all throw a runtime_error before anything
+  // is allocated.
+  void set_memory_budget(uint64_t bytes) {
+    budget = bytes;
+  }
+
+  // How multiply and multiply_add handle a product.
+  enum Algorithm {
+    // Direct convolution, for a short operand.
+    DIRECT,
+    // A cyclic product of a power of three length.
+    CYCLIC,
+    // Cyclic products of pieces of the operands, added into the result, to
+    // stay within the memory budget.
+    CHUNKED
+  };
+
+  // Per-machine costs from which estimate predicts running times. The
+  // defaults were measured on one x86-64 core; calibrate() measures them on
+  // the current machine. Products that outgrow the caches run up to about
+  // 1.5 times slower than predicted.
+  struct Options {
+    // Seconds per coefficient product in direct convolution.
+    double direct;
+    // Seconds per n*log_3(n) for a cyclic product of length n.
+    double cyclic;
+
+    Options(double direct = 1.0e-9, double cyclic = 3.5e-8)
+        : direct(direct), cyclic(cyclic) { }
+  };
+
+  // What a product of given lengths will cost.
+  struct Estimate {
+    Algorithm algorithm;
+    // The transform length, of the pieces for CHUNKED, or 0 for direct
+    // convolution.
+    uint64_t length;
+    // The peak memory allocated, including the result.
+    uint64_t bytes;
+    // The predicted running time.
+    double seconds;
+  };
+
+  // Returns what multiply will do with operands of plen and qlen
+  // coefficients, without doing it. Throws the runtime_error multiply would
+  // throw if the product does not fit in the memory budget.
+  Estimate estimate(uint64_t plen, uint64_t qlen,
+                    const Options &options = Options()) {
+    uint64_t len = plen && qlen ? plen + qlen - 1 : 0;
+    Plan plan = planned(plen, qlen, len*sizeof(int64_t));
+    Estimate e;
+    e.algorithm = plan.algorithm;
+    e.length = plan.length;
+    e.bytes = len*sizeof(int64_t);
+    if (e.algorithm == DIRECT) {
+      e.seconds = options.direct*plen*qlen;
+    } else {
+      uint64_t n = e.length, levels = 0;
+      for (uint64_t i = 1; i < n; i *= 3) {
+        ++levels;
+      }
+      uint64_t pieces = (plen + plan.pchunk - 1)/plan.pchunk*
+                        ((qlen + plan.qchunk - 1)/plan.qchunk);
+      e.bytes += cyclic_bytes(n);
+      e.seconds = options.cyclic*n*levels*pieces;
+    }
+    return e;
+  }
+
+  // Measures the Options of the current machine, in about a second.
+  static Options calibrate() {
+    Conv64 c;
+    Options o;
+    vector<int64_t> p(59049), q(DIRECT_MAX);
+    for (uint64_t i = 0; i < p.size(); ++i) {
+      p[i] = i*0x9e3779b97f4a7c15ull;
+    }
+    for (uint64_t i = 0; i < q.size(); ++i) {
+      q[i] = i*0xc2b2ae3d27d4eb4full;
+    }
+    Options unit(1, 1);
+    o.direct = c.best_of(p, q)/c.estimate(p.size(), q.size(), unit).seconds;
+    q = p;
+    o.cyclic = c.best_of(p, q)/c.estimate(p.size(), q.size(), unit).seconds;
+    return o;
+  }
+
+  // Returns the coefficients lo, ..., hi - 1 of the product of p and q, and
+  // throws a runtime_error if lo > hi.
+  //
+  // Only p[a..b) and q[c..d) can contribute to these, and of their product
+  // P*Q we want the window of w = hi - lo coefficients starting at
+  // w0 = lo - a - c. A cyclic product of length N keeps the window intact
+  // as long as nothing else folds onto it, that is when N >= w0 + w and
+  // N >= |P| + |Q| - 1 - w0. For a window in the middle of a long product
+  // this is about half the length that `multiply` would use. Operands longer
+  // than N are folded modulo x^N - 1 first.
+  template<class I, class J>
+  vector<int64_t> multiply_range(const vector<I> &p, const vector<J> &q,
+                                 uint64_t lo, uint64_t hi) {
+    if (lo > hi) {
+      throw runtime_error("multiply_range: lo = " + to_string(lo) +
+                          " is past hi = " + to_string(hi));
+    }
+    Recorder::Scope scope(recorder, Recorder::MULTIPLY_RANGE, p, q);
+    scope.arg(0, lo);
+    scope.arg(1, hi);
+    vector<int64_t> res(hi - lo);
+    hi = min<uint64_t>(hi, p.size() + q.size() - 1);
+    if (p.empty() || q.empty() || lo >= hi) {
+      return res;
+    }
+    uint64_t a = lo + 1 > q.size() ? lo + 1 - q.size() : 0;
+    uint64_t b = min<uint64_t>(p.size(), hi);
+    uint64_t c = lo + 1 > b ? lo + 1 - b : 0;
+    uint64_t d = min<uint64_t>(q.size(), hi - a);
+    uint64_t w = hi - lo, w0 = lo - a - c, len = (b - a) + (d - c) - 1;
+    uint64_t n = 1;
+    while (n < w0 + w || n + w0 < len) {
+      n *= 3;
+    }
+    vector<int64_t> pf, qf;
+    vector<uint64_t> target(n);
+    if (b - a > n) {
+      pf = fold(p.data() + a, b - a, n);
+    }
+    if (d - c > n) {
+      qf = fold(q.data() + c, d - c, n);
+    }
+    if (pf.empty() && qf.empty()) {
+      multiply_cyclic_raw(p.data() + a, b - a, q.data() + c, d - c, n,
+                          target.data(), n, false);
+    } else if (pf.empty()) {
+      multiply_cyclic_raw(p.data() + a, b - a, qf.data(), n, n, target.data(),
+                          n, false);
+    } else if (qf.empty()) {
+      multiply_cyclic_raw(pf.data(), n, q.data() + c, d - c, n, target.data(),
+                          n, false);
+    } else {
+      multiply_cyclic_raw(pf.data(), n, qf.data(), n, n, target.data(), n,
+                          false);
+    }
+    for (uint64_t i = 0; i < w; ++i) {
+      res[i] = target[w0 + i];
+    }
+    return res;
+  }
+
+  // Returns the product of two polynomials with integer coefficients, without
+  // reducing modulo 2^64. The result is exact as long as every coefficient of
+  // the product is smaller than 2^124 in absolute value, which holds for
+  // instance for 48-bit inputs with up to 2^28 terms.
+  //
+  // The product modulo 2^64 comes from `multiply`, and the product modulo the
+  // prime PRIME from a number theoretic transform. Since 2^64 and PRIME are
+  // coprime, the two determine the product modulo 2^64*PRIME > 2^125.
+  vector<__int128> multiply_exact(const vector<int64_t> &p,
+                                  const vector<int64_t> &q) {
+    Recorder::Scope scope(recorder, Recorder::MULTIPLY_EXACT, p, q);
+    vector<int64_t> lo = multiply(p, q);
+    uint64_t s = 1;
+    while (s < lo.size()) {
+      s *= 2;
+    }
+    vector<uint64_t> pp(s), qq(s);
+    for (uint64_t i = 0; i < p.size(); ++i) {
+      pp[i] = reduce(p[i]);
+    }
+    for (uint64_t i = 0; i < q.size(); ++i) {
+      qq[i] = reduce(q[i]);
+    }
+    ntt(pp, false);
+    ntt(qq, false);
+    for (uint64_t i = 0; i < s; ++i) {
+      pp[i] = mulmod(pp[i], qq[i]);
+    }
+    ntt(pp, true);
+
+    // With a = c mod 2^64 and b = c mod PRIME, c = a + 2^64*t where
+    // t = (b - a)/2^64 mod PRIME. Results above half the modulus are negative.
+    const unsigned __int128 MOD = (unsigned __int128)PRIME << 64;
+    uint64_t inv = powmod(((unsigned __int128)1 << 64) % PRIME, PRIME - 2);
+    vector<__int128> res(lo.size());
+    for (uint64_t i = 0; i < lo.size(); ++i) {
+      uint64_t a = lo[i];
+      uint64_t t = mulmod((pp[i] + PRIME - a % PRIME) % PRIME, inv);
+      unsigned __int128 c = ((unsigned __int128)t << 64) + a;
+      res[i] = c >= MOD/2 ? (__int128)(c - MOD) : (__int128)c;
+    }
+    return res;
+  }
+
+  // The spectrum of a polynomial from R[x]/(x^n - 1), n being a power of
+  // three: the spectra (see below) of the blocks that multiply_cyclic_raw
+  // hands to mul after its fftdif.
+  struct Spectrum {
+    uint64_t n;
+    vector<T> data;
+  };
+
+  // A spectrum written to a file by save, mapped read-only into memory, so
+  // that it is ready as soon as it is opened and every process mapping the
+  // same file shares its pages.
+  //
+  // The file starts with a 64 byte header of words in the native byte
+  // order: the magic "conv64sp", the format version, n, the number of
+  // elements of T, and the block and leaf sizes that fix the layout of the
+  // data. The data follows, exactly as in Spectrum::data.
+  class MappedSpectrum {
+    public:
+
+    uint64_t n;
+    const T *data;
+    uint64_t size;
+
+    explicit MappedSpectrum(const string &file) {
+      int fd = open(file.c_str(), O_RDONLY);
+      struct stat st;
+      if (fd < 0 || fstat(fd, &st) < 0 || (uint64_t)st.st_size < HEADER) {
+        if (fd >= 0) close(fd);
+        throw runtime_error("cannot read spectrum " + file);
+      }
+      bytes = st.st_size;
+      base = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+      close(fd);
+      if (base == MAP_FAILED) {
+        throw runtime_error("cannot map spectrum " + file);
+      }
+      const uint64_t *h = (const uint64_t*)base;
+      Conv64 c;
+      n = h[2];
+      size = h[3];
+      data = (const T*)((const char*)base + HEADER);
+      if (memcmp(h, MAGIC, 8) != 0 || h[1] != VERSION) {
+        munmap(base, bytes);
+        throw runtime_error(file + " is not a spectrum of this version");
+      }
+      // A spectrum has at least n elements, so checking that first keeps
+      // the layout functions away from lengths that overflow.
+      if (!power_of_three(n) || n > (bytes - HEADER)/sizeof(T) ||
+          h[4] != c.cyclic_block_size(n) || h[5] != c.leaf_size(h[4]) ||
+          size != c.spectrum_length(n) || bytes != HEADER + size*sizeof(T)) {
+        munmap(base, bytes);
+        throw runtime_error(file + " does not match this build's layout");
+      }
+    }
+
+    ~MappedSpectrum() {
+      munmap(base, bytes);
+    }
+
+    MappedSpectrum(const MappedSpectrum&) = delete;
+    MappedSpectrum &operator=(const MappedSpectrum&) = delete;
+
+    private:
+    void *base;
+    uint64_t bytes;
+  };
+
+  // A read-only view of a Spectrum or a MappedSpectrum.
+  struct SpectrumRef {
+    uint64_t n;
+    const T *data;
+    uint64_t size;
+
+    SpectrumRef(const Spectrum &s) : n(s.n), data(s.data.data()),
+                                     size(s.data.size()) { }
+    SpectrumRef(const MappedSpectrum &s) : n(s.n), data(s.data),
+                                           size(s.size) { }
+  };
+
+  // Writes a spectrum to a file, for MappedSpectrum.
+  void save(const Spectrum &s, const string &file) {
+    uint64_t m = cyclic_block_size(s.n);
+    uint64_t h[HEADER/8] = {0, VERSION, s.n, s.data.size(), m, leaf_size(m)};
+    memcpy(h, MAGIC, 8);
+    ofstream out(file, ios::binary);
+    out.write((const char*)h, HEADER);
+    out.write((const char*)s.data.data(), s.data.size()*sizeof(T));
+    if (!out) {
+      throw runtime_error("cannot write spectrum " + file);
+    }
+  }
+
+  // Returns the spectrum of p as an element of R[x]/(x^n - 1), where n is a
+  // power of three and p has at most n coefficients.
+  Spectrum transform(const vector<int64_t> &p, uint64_t n) {
+    Recorder::Scope scope(recorder, Recorder::TRANSFORM);
+    scope.operand(p);
+    scope.arg(0, n);
+    uint64_t m = cyclic_block_size(n);
+    uint64_t r = n/m;
+    uint64_t s = spectrum_size(m);
+    Spectrum res;
+    res.n = n;
+    res.data.resize(spectrum_length(n));
+
+    // pp: length n
+    // work: length work_size(m)
+    // tmp: length 3*m
+    T *buf = new T[n + work_size(m) + 3*m];
+    T *pp = buf;
+    T *work = buf + n;
+    tmp = work + work_size(m);
+    Trace::Span span(trace, "transform", n);
+
+    for (uint64_t i = 0; i < n; ++i) {
+      pp[i] = i < p.size() ? p[i] : 0;
+    }
+    fftdif(pp, m, r);
+    for (uint64_t i = 0; i < r; ++i) {
+      transform(pp + m*i, m, res.data.data() + s*i, work);
+    }
+
+    delete[] buf;
+    return res;
+  }
+
+  // Adds the spectrum of the product of the polynomials with spectra a and b
+  // to acc. All three must have been computed for the same n.
+  void multiply_add(SpectrumRef a, SpectrumRef b, Spectrum &acc) {
+    Recorder::Scope scope(recorder, Recorder::MULTIPLY_ADD_SPECTRA);
+    scope.arg(0, a.n);
+    check(a, "multiply_add");
+    check(b, "multiply_add");
+    check(acc, "multiply_add");
+    if (a.n != b.n || a.n != acc.n) {
+      throw runtime_error("multiply_add: spectra for n = " + to_string(a.n) +
+                          ", " + to_string(b.n) + " and " + to_string(acc.n));
+    }
+    uint64_t m = cyclic_block_size(a.n);
+    Trace::Span span(trace, "pointwise", a.n);
+    pointwise(a.data, b.data, m, a.size, acc.data.data());
+  }
+
+  // Returns the polynomial in R[x]/(x^n - 1) with spectrum c, as a vector of
+  // n coefficients.
+  vector<int64_t> inverse(SpectrumRef c) {
+    Recorder::Scope scope(recorder, Recorder::INVERSE);
+    scope.arg(0, c.n);
+    check(c, "inverse");
+    uint64_t n = c.n;
+    uint64_t m = cyclic_block_size(n);
+    uint64_t r = n/m;
+    uint64_t s = spectrum_size(m);
+
+    T inv = 1;
+    for (uint64_t i = 1; i < r; i *= 3) {
+      inv *= INV3;
+    }
+
+    // pp: length n
+    // to: length n
+    // work: length work_size(m)
+    // tmp: length 3*m
+    T *buf = new T[2*n + work_size(m) + 3*m];
+    T *pp = buf;
+    T *to = buf + n;
+    T *work = buf + 2*n;
+    tmp = work + work_size(m);
+    Trace::Span span(trace, "inverse", n);
+
+    for (uint64_t i = 0; i < r; ++i) {
+      inverse(c.data + s*i, m, pp + m*i, work);
+    }
+    fftdit(pp, m, r);
+    for (uint64_t i = 0; i < n; ++i) {
+      pp[i] *= inv;
+    }
+    vector<int64_t> res(n);
+    extract(pp, n, m, to, (uint64_t*)res.data(), n, false);
+
+    delete[] buf;
+    return res;
+  }
+
+  // Returns the product in R[x]/(x^n - 1) of the polynomials with spectra a
+  // and b, which must have been computed for the same n.
+  vector<int64_t> multiply_cyclic(SpectrumRef a, SpectrumRef b) {
+    Recorder::Scope scope(recorder, Recorder::MULTIPLY_CYCLIC);
+    scope.arg(0, a.n);
+    check(a, "multiply_cyclic");
+    check(b, "multiply_cyclic");
+    if (a.n != b.n) {
+      throw runtime_error("multiply_cyclic: spectra for n = " +
+                          to_string(a.n) + " and " + to_string(b.n));
+    }
+    Spectrum c = {a.n, vector<T>(a.size)};
+    multiply_add(a, b, c);
+    return inverse(c);
+  }
+
+  // Returns p, which has len coefficients, reduced modulo x^n - 1.
+  template<class I>
+  static vector<int64_t> fold(const I *p, uint64_t len, uint64_t n) {
+    vector<int64_t> res(n);
+    for (uint64_t i = 0; i < len; ++i) {
+      res[i % n] = (uint64_t)res[i % n] + (uint64_t)(int64_t)p[i];
+    }
+    return res;
+  }
+
+  typedef vector<vector<vector<int64_t>>> Matrix;
+
+  // Returns the product of a k x l matrix and an l x k' matrix whose entries
+  // are polynomials from R[x], an empty vector standing for 0.
+  //
+  // Every entry is transformed once and every entry of the result inverse
+  // transformed once, and the matrix product itself is done on the leaf
+  // blocks of the spectra. This takes kl + lk' transforms and kk' inverses
+  // instead of the 3klk' of multiplying entry by entry.
+  Matrix multiply(const Matrix &a, const Matrix &b) {
+    uint64_t k = a.size(), l = b.size(), kk = l ? b[0].size() : 0;
+    for (uint64_t i = 0; i < k; ++i) {
+      if (a[i].size() != l) {
+        throw runtime_error("multiply: row " + to_string(i) + " of the left " +
+                            "matrix has " + to_string(a[i].size()) +
+                            " entries, but the right matrix has " +
+                            to_string(l) + " rows");
+      }
+    }
+    for (uint64_t t = 0; t < l; ++t) {
+      if (b[t].size() != kk) {
+        throw runtime_error("multiply: row " + to_string(t) + " of the " +
+                            "right matrix has " + to_string(b[t].size()) +
+                            " entries, but row 0 has " + to_string(kk));
+      }
+    }
+    Recorder::Scope scope(recorder, Recorder::MULTIPLY_MATRIX);
+    for (const auto &row : a) {
+      for (const auto &e : row) {
+        scope.operand(e);
+      }
+    }
+    for (const auto &row : b) {
+      for (const auto &e : row) {
+        scope.operand(e);
+      }
+    }
+    scope.arg(0, k);
+    scope.arg(1, l);
+    scope.arg(2, kk);
+    uint64_t alen = 0, blen = 0;
+    for (uint64_t i = 0; i < k; ++i) {
+      for (uint64_t t = 0; t < l; ++t) {
+        alen = max<uint64_t>(alen, a[i][t].size());
+      }
+    }
+    for (uint64_t t = 0; t < l; ++t) {
+      for (uint64_t j = 0; j < kk; ++j) {
+        blen = max<uint64_t>(blen, b[t][j].size());
+      }
+    }
+    Matrix res(k, vector<vector<int64_t>>(kk));
+    if (alen == 0 || blen == 0) {
+      return res;
+    }
+    uint64_t n = 1;
+    while (n < alen + blen - 1) {
+      n *= 3;
+    }
+
+    vector<vector<Spectrum>> bs(l);
+    for (uint64_t t = 0; t < l; ++t) {
+      for (uint64_t j = 0; j < kk; ++j) {
+        bs[t].push_back(transform(b[t][j], n));
+      }
+    }
+    vector<Spectrum> as(l);
+    for (uint64_t i = 0; i < k; ++i) {
+      for (uint64_t t = 0; t < l; ++t) {
+        as[t] = transform(a[i][t], n);
+      }
+      for (uint64_t j = 0; j < kk; ++j) {
+        uint64_t len = 0;
+        Spectrum c = {n, vector<T>(as[0].data.size())};
+        for (uint64_t t = 0; t < l; ++t) {
+          if (!a[i][t].empty() && !b[t][j].empty()) {
+            len = max<uint64_t>(len, a[i][t].size() + b[t][j].size() - 1);
+            multiply_add(as[t], bs[t][j], c);
+          }
+        }
+        if (len > 0) {
+          res[i][j] = inverse(c);
+          res[i][j].resize(len);
+        }
+      }
+    }
+    return res;
+  }
+
+  // Returns the products of `signal` with each of `filters`.
+  //
+  // A filter f is multiplied by overlap-add: with s the smallest power of
+  // three >= 2|f|, the signal is cut into blocks of s - |f| + 1 coefficients
+  // whose cyclic products with f of length s do not wrap around. Filters are
+  // grouped by s and, within a group, by the block length for the longest of
+  // them, so the spectra of the signal blocks are computed once per group and
+  // shared by all its filters. The work is spread over all hardware threads,
+  // across blocks for the signal spectra and across filters for the
+  // products.
+  vector<vector<int64_t>> multiply_many(const vector<int64_t> &signal,
+                                        const vector<vector<int64_t>> &filters) {
+    Recorder::Scope scope(recorder, Recorder::MULTIPLY_MANY);
+    scope.operand(signal);
+    for (const auto &f : filters) {
+      scope.operand(f);
+    }
+    uint64_t k = filters.size();
+    vector<vector<int64_t>> res(k);
+    if (signal.empty()) {
+      return res;
+    }
+
+    // The transform length for each filter, or 0 if it is multiplied
+    // directly.
+    vector<uint64_t> len(k);
+    for (uint64_t i = 0; i < k; ++i) {
+      if (min(signal.size(), filters[i].size()) <= DIRECT_MAX) {
+        continue;
+      }
+      len[i] = 1;
+      while (len[i] < 2*filters[i].size() &&
+             len[i] < signal.size() + filters[i].size() - 1) {
+        len[i] *= 3;
+      }
+    }
+    parallel(k, [&](Conv64 &c, uint64_t i) {
+      if (len[i] == 0 && !filters[i].empty()) {
+        res[i] = c.multiply(signal, filters[i]);
+      }
+    });
+
+    vector<uint64_t> sizes = len;
+    sort(sizes.begin(), sizes.end());
+    sizes.erase(unique(sizes.begin(), sizes.end()), sizes.end());
+    for (uint64_t s : sizes) {
+      if (s == 0) {
+        continue;
+      }
+      vector<uint64_t> group;
+      uint64_t longest = 0;
+      for (uint64_t i = 0; i < k; ++i) {
+        if (len[i] == s) {
+          group.push_back(i);
+          longest = max<uint64_t>(longest, filters[i].size());
+        }
+      }
+      uint64_t b = s - longest + 1;
+      uint64_t blocks = (signal.size() + b - 1)/b;
+      vector<Spectrum> spectra(blocks);
+      parallel(blocks, [&](Conv64 &c, uint64_t j) {
+        uint64_t end = min<uint64_t>(signal.size(), (j + 1)*b);
+        spectra[j] = c.transform(vector<int64_t>(signal.begin() + j*b,
+                                                 signal.begin() + end), s);
+      });
+      parallel(group.size(), [&](Conv64 &c, uint64_t g) {
+        const vector<int64_t> &f = filters[group[g]];
+        vector<int64_t> &out = res[group[g]];
+        out.assign(signal.size() + f.size() - 1, 0);
+        Spectrum fs = c.transform(f, s);
+        for (uint64_t j = 0; j < blocks; ++j) {
+          vector<int64_t> prod = c.multiply_cyclic(spectra[j], fs);
+          for (uint64_t t = 0; t < s && j*b + t < out.size(); ++t) {
+            out[j*b + t] = (uint64_t)out[j*b + t] + prod[t];
+          }
+        }
+      });
+    }
+    return res;
+  }
+
+  // Returns the products p[i]*q[i] of independent pairs of polynomials, as
+  // multiply would.
+  //
+  // A product rounded up to a transform of power of three length s leaves
+  // room that smaller products of the batch are packed into. With products
+  // 0, ..., k - 1 of a group at offsets 0 = o_0 < o_1 < ... in both operands,
+  // P = sum p_i x^(o_i) and Q = sum q_i x^(o_i), the product P*Q holds each
+  // p_i q_i at 2 o_i, and a cross term p_i q_j, i < j, at o_i + o_j. That lies
+  // past every product before j if o_j >= 2 o_(j-1) + |p_(j-1) q_(j-1)|, and
+  // ends before product j if o_j >= o_(j-1) + the length of every cross term
+  // with j. As these gaps grow geometrically, a group only takes products
+  // that fit into the length s of its largest one, largest first, so that
+  // they cost nothing extra. The groups and the remaining products are spread
+  // over all hardware threads.
+  vector<vector<int64_t>> multiply_batch(const vector<vector<int64_t>> &p,
+                                         const vector<vector<int64_t>> &q) {
+    if (p.size() != q.size()) {
+      throw runtime_error("multiply_batch: " + to_string(p.size()) +
+                          " left operands but " + to_string(q.size()) +
+                          " right operands");
+    }
+    Recorder::Scope scope(recorder, Recorder::MULTIPLY_BATCH);
+    for (uint64_t i = 0; i < p.size(); ++i) {
+      scope.operand(p[i]);
+      scope.operand(q[i]);
+    }
+    uint64_t k = p.size();
+    vector<vector<int64_t>> res(k);
+    vector<uint64_t> order;
+    for (uint64_t i = 0; i < k; ++i) {
+      if (!p[i].empty() && !q[i].empty()) {
+        order.push_back(i);
+      }
+    }
+    auto width = [&](uint64_t i, uint64_t j) {
+      return p[i].size() + q[j].size() - 1;
+    };
+    stable_sort(order.begin(), order.end(), [&](uint64_t i, uint64_t j) {
+      return width(i, i) > width(j, j);
+    });
+
+    // The products of each group, with their offsets and the transform
+    // length, 0 for a product on its own.
+    struct Group {
+      vector<uint64_t> index, offset;
+      uint64_t length;
+    };
+    vector<Group> groups;
+    vector<bool> taken(k);
+    for (uint64_t a = 0; a < order.size(); ++a) {
+      uint64_t h = order[a];
+      if (taken[h]) continue;
+      taken[h] = true;
+      Group g = {{h}, {0}, 0};
+      uint64_t len = width(h, h);
+      Plan plan = planned(p[h].size(), q[h].size(), len*sizeof(int64_t));
+      uint64_t s = plan.length;
+      if (plan.algorithm == CYCLIC &&
+          (!budget || cyclic_bytes(s) + 3*s*sizeof(uint64_t) <= budget)) {
+        for (uint64_t b = a + 1; b < order.size(); ++b) {
+          uint64_t j = order[b];
+          if (taken[j]) continue;
+          uint64_t last = g.index.back(), o = g.offset.back();
+          uint64_t next = 2*o + width(last, last);
+          for (uint64_t i : g.index) {
+            next = max(next, o + max(width(i, j), width(j, i)));
+          }
+          if (2*next + width(j, j) <= s) {
+            g.index.push_back(j);
+            g.offset.push_back(next);
+            taken[j] = true;
+          }
+        }
+        if (g.index.size() > 1) {
+          g.length = s;
+        }
+      }
+      groups.push_back(g);
+    }
+
+    parallel(groups.size(), [&](Conv64 &c, uint64_t t) {
+      const Group &g = groups[t];
+      if (g.length == 0) {
+        res[g.index[0]] = c.multiply(p[g.index[0]], q[g.index[0]]);
+        return;
+      }
+      uint64_t last = g.index.back(), o = g.offset.back();
+      vector<int64_t> pp(o + p[last].size()), qq(o + q[last].size());
+      for (uint64_t i = 0; i < g.index.size(); ++i) {
+        const vector<int64_t> &a = p[g.index[i]], &b = q[g.index[i]];
+        copy(a.begin(), a.end(), pp.begin() + g.offset[i]);
+        copy(b.begin(), b.end(), qq.begin() + g.offset[i]);
+      }
+      uint64_t len = 2*o + width(last, last);
+      vector<int64_t> prod(len);
+      c.multiply_cyclic_raw(pp.data(), pp.size(), qq.data(), qq.size(),
+                            g.length, (uint64_t*)prod.data(), len, false);
+      for (uint64_t i = 0; i < g.index.size(); ++i) {
+        uint64_t j = g.index[i];
+        res[j].assign(prod.begin() + 2*g.offset[i],
+                      prod.begin() + 2*g.offset[i] + width(j, j));
+        if (c.repetitions && !c.verify(p[j], q[j], res[j], c.repetitions)) {
+          throw runtime_error("multiply_batch: a product failed verification");
+        }
+      }
+    });
+    return res;
+  }
+
+  private:
+
+  // Temporary space.
+  T *tmp;
+
+  // Where to record spans, if anywhere.
+  Trace *trace = nullptr;
+
+  // The file format of MappedSpectrum.
+  static constexpr const char *MAGIC = "conv64sp";
+  static const uint64_t VERSION = 1;
+  static const uint64_t HEADER = 64;
+
+  // Where to log calls, if anywhere.
+  Recorder *recorder = nullptr;
+
+  // The memory budget in bytes, or 0.
+  uint64_t budget = 0;
+
+  // Where to run parallel tasks and at what priority, if anywhere.
+  Scheduler *scheduler = nullptr;
+  int priority = 0;
+
+  // How many times multiply verifies each product.
+  unsigned repetitions = 0;
+
+  // The recursion depth of mul, and the output of the convolve at that
+  // depth, from which a mul finds the index of its block.
+  uint64_t depth = 0;
+  const T *out = nullptr;
+
+  // A prime below 2^62 of the form 29*2^57 + 1, for which 3 is a primitive
+  // root, used by multiply_exact.
+  static const uint64_t PRIME = 4179340454199820289ull;
+
+  // Returns x modulo PRIME, in [0, PRIME).
+  uint64_t reduce(int64_t x) {
+    int64_t r = x % (int64_t)PRIME;
+    return r < 0 ? r + PRIME : r;
+  }
+
+  uint64_t mulmod(uint64_t a, uint64_t b) {
+    return (unsigned __int128)a*b % PRIME;
+  }
+
+  uint64_t powmod(uint64_t a, uint64_t e) {
+    uint64_t res = 1;
+    for (; e; e >>= 1, a = mulmod(a, a)) {
+      if (e & 1) res = mulmod(res, a);
+    }
+    return res;
+  }
+
+  // In-place Radix-2 number theoretic transform modulo PRIME, of length a
+  // power of two. The inverse includes the division by the length.
+  void ntt(vector<uint64_t> &p, bool invert) {
+    uint64_t n = p.size();
+    for (uint64_t i = 1, j = 0; i < n; ++i) {
+      uint64_t bit = n >> 1;
+      for (; j & bit; bit >>= 1) {
+        j ^= bit;
+      }
+      j ^= bit;
+      if (i < j) swap(p[i], p[j]);
+    }
+    for (uint64_t len = 2; len <= n; len *= 2) {
+      uint64_t w = powmod(3, (PRIME - 1)/len);
+      if (invert) w = powmod(w, PRIME - 2);
+      for (uint64_t i = 0; i < n; i += len) {
+        uint64_t wj = 1;
+        for (uint64_t j = 0; j < len/2; ++j) {
+          uint64_t u = p[i + j], v = mulmod(p[i + j + len/2], wj);
+          p[i + j] = u + v < PRIME ? u + v : u + v - PRIME;
+          p[i + j + len/2] = u >= v ? u - v : u + PRIME - v;
+          wj = mulmod(wj, w);
+        }
+      }
+    }
+    if (invert) {
+      uint64_t inv = powmod(n, PRIME - 2);
+      for (uint64_t i = 0; i < n; ++i) {
+        p[i] = mulmod(p[i], inv);
+      }
+    }
+  }
+
+  // Returns the product of a polynomial and the monomial x^t in the ring
+  // T[x]/(x^m - omega). The result is placed in `to`.
+  // NOTE: t must be in the range [0,3m]
+  void twiddle(T *p, uint64_t m, uint64_t t, T *to) {
+    if (t == 0 || t == 3*m) {
+      for (uint64_t j = 0; j < m; ++j) {
+        to[j] = p[j];
+      }
+      return;
+    }
+    uint64_t tt;
+    T mult = 1;
+    if (t < m) {
+      tt = t;
+    } else if (t < 2*m) {
+      tt = t - m;
+      mult = OMEGA;
+    } else {
+      tt = t - 2*m;
+      mult = OMEGA2;
+    }
+    for (uint64_t j=0;j<tt;j++) {
+      to[j] = p[m - tt + j]*OMEGA*mult;
+    }
+    for (uint64_t j=tt;j<m;j++) {
+      to[j] = p[j-tt]*mult;
+    }
+  }
+
+  // A "Decimation In Frequency" In-Place Radix-3 FFT Routine.
+  // Input: A polynomial from (T[x]/(x^m - omega))[y]/(y^r - 1).
+  // Output: Its Fourier transform (w.r.t. y) in 3-reversed order.
+  void fftdif(T *p, uint64_t m, uint64_t r) {
+    if (r == 1 || codelet_fftdif(p, m, r)) return;
+    uint64_t rr = r/3;
+    uint64_t pos1 = m*rr, pos2 = 2*m*rr;
+    for (uint64_t i = 0; i < rr; ++i) {
+      for (uint64_t j = 0; j < m; ++j) {
+        tmp[j] = p[i*m + j] + p[pos1 + i*m + j] + p[pos2 + i*m + j];
+        tmp[m + j] = p[i*m + j] + OMEGA*p[pos1 + i*m + j] + OMEGA2*p[pos2 + i*m + j];
+        tmp[2*m + j] = p[i*m + j] + OMEGA2*p[pos1 + i*m + j] + OMEGA*p[pos2 + i*m + j];
+        p[i*m + j] = tmp[j];
+      }
+      twiddle(tmp + m, m, 3*i*m/r, p + pos1 + i*m);
+      twiddle(tmp + 2*m, m, 6*i*m/r, p + pos2 + i*m);
+    }
+    fftdif(p, m, rr);
+    fftdif(p + pos1, m, rr);
+    fftdif(p + pos2, m, rr);
+  }
+
+  // The outermost level of fftdif, applied to two polynomials at once. Both
+  // operands go through the butterflies in the same sweep, so the block
+  // offsets and twiddle amounts are only computed once and the two
+  // independent dependency chains can overlap. Uses 4m elements of `tmp`.
+  void difstep2(T *p, T *q, uint64_t m, uint64_t r) {
+    for (uint64_t i = 0; i < r/3; ++i) {
+      difrow2(p, q, m, r, i);
+    }
+  }
+
+  // The butterflies of difstep2 for the blocks i, i + r/3 and i + 2r/3.
+  void difrow2(T *p, T *q, uint64_t m, uint64_t r, uint64_t i) {
+    uint64_t pos1 = m*(r/3), pos2 = 2*m*(r/3);
+    difbutterfly2(p + i*m, p + pos1 + i*m, p + pos2 + i*m,
+                  q + i*m, q + pos1 + i*m, q + pos2 + i*m, m, 3*i*m/r);
+  }
+
+  // A DIF butterfly on the blocks p0, p1, p2 of length m, with the outputs
+  // for p1 and p2 multiplied by x^t and x^(2t), and the same on q0, q1, q2.
+  void difbutterfly2(T *p0, T *p1, T *p2, T *q0, T *q1, T *q2, uint64_t m,
+                     uint64_t t) {
+    for (uint64_t j = 0; j < m; ++j) {
+      T u0 = p0[j], u1 = p1[j], u2 = p2[j];
+      T v0 = q0[j], v1 = q1[j], v2 = q2[j];
+      p0[j] = u0 + u1 + u2;
+      q0[j] = v0 + v1 + v2;
+      tmp[j] = u0 + OMEGA*u1 + OMEGA2*u2;
+      tmp[2*m + j] = v0 + OMEGA*v1 + OMEGA2*v2;
+      tmp[m + j] = u0 + OMEGA2*u1 + OMEGA*u2;
+      tmp[3*m + j] = v0 + OMEGA2*v1 + OMEGA*v2;
+    }
+    twiddle(tmp, m, t, p1);
+    twiddle(tmp + m, m, 2*t, p2);
+    twiddle(tmp + 2*m, m, t, q1);
+    twiddle(tmp + 3*m, m, 2*t, q2);
+  }
+
+  // A "Decimation In Time" In-Place Radix-3 Inverse FFT Routine.
+  // Input: A polynomial in (T[x]/(x^m - omega))[y]/(y^r - 1) with coefficients
+  //        in 3-reversed order.
+  // Output: Its inverse Fourier transform in normal order.
+  void fftdit(T *p, uint64_t m, uint64_t r) {
+    if (r == 1 || codelet_fftdit(p, m, r)) return;
+    uint64_t rr = r/3;
+    uint64_t pos1 = m*rr, pos2 = 2*m*rr;
+    fftdit(p, m, rr);
+    fftdit(p + pos1, m, rr);
+    fftdit(p + pos2, m, rr);
+    ditstep(p, m, r);
+  }
+
+  // The outermost level of fftdit, to be run once the three thirds of p have
+  // been inverse transformed.
+  void ditstep(T *p, uint64_t m, uint64_t r) {
+    uint64_t rr = r/3;
+    uint64_t pos1 = m*rr, pos2 = 2*m*rr;
+    for (uint64_t i = 0; i < rr; ++i) {
+      ditbutterfly(p + i*m, p + pos1 + i*m, p + pos2 + i*m, m, 3*i*m/r);
+    }
+  }
+
+  // The inverse of the butterfly in difbutterfly2, on a single polynomial:
+  // p1 and p2 are multiplied by x^(-t) and x^(-2t) before being combined.
+  void ditbutterfly(T *p0, T *p1, T *p2, uint64_t m, uint64_t t) {
+    twiddle(p1, m, 3*m - t, tmp + m);
+    twiddle(p2, m, 3*m - 2*t, tmp + 2*m);
+    for(uint64_t j = 0; j < m; ++j) {
+      tmp[j] = p0[j];
+      p0[j] = tmp[j] + tmp[m + j] + tmp[2*m + j];
+      p1[j] = tmp[j] + OMEGA2*tmp[m + j] + OMEGA*tmp[2*m + j];
+      p2[j] = tmp[j] + OMEGA*tmp[m + j] + OMEGA2*tmp[2*m + j];
+    }
+  }
+
+  // Computes the product of p and q in (T[x]/(x^m - omega))[y]/(y^r - 1),
+  // multiplied by r since the inverse transform does not divide by 3. The
+  // result is placed in `to`, and p and q are destroyed.
+  //
+  // This is fftdif on both operands, the r pointwise products and fftdit,
+  // scheduled depth first: each level runs its forward butterflies, handles
+  // the three thirds one after the other and then runs its inverse
+  // butterflies. Once a third fits in cache, its remaining transform levels,
+  // its pointwise products and its first inverse levels all run on data that
+  // is already there, instead of every stage sweeping the whole array.
+  void convolve(T *p, T *q, uint64_t m, uint64_t r, T *to) {
+    if (scheduler) {
+      scheduler->yield(priority);
+    }
+    if (r == 1) {
+      mul(p, q, m, to);
+      return;
+    }
+    // Shapes this small fit in cache whole, so a straight-line transform of
+    // each operand beats the depth first schedule.
+    if (codelet_fftdif(p, m, r)) {
+      codelet_fftdif(q, m, r);
+      for (uint64_t i = 0; i < r; ++i) {
+        mul(p + i*m, q + i*m, m, to + i*m);
+      }
+      codelet_fftdit(to, m, r);
+      return;
+    }
+    difstep2(p, q, m, r);
+    convolve_thirds(p, q, m, r, to);
+  }
+
+  // The part of convolve that follows the outermost forward butterflies.
+  void convolve_thirds(T *p, T *q, uint64_t m, uint64_t r, T *to) {
+    uint64_t rr = r/3;
+    uint64_t pos1 = m*rr, pos2 = 2*m*rr;
+    // mul uses the space after its output as scratch, so the thirds must be
+    // handled in increasing order.
+    convolve(p, q, m, rr, to);
+    convolve(p + pos1, q + pos1, m, rr, to + pos1);
+    convolve(p + pos2, q + pos2, m, rr, to + pos2);
+    ditstep(to, m, r);
+  }
+
+  // Computes the product of two polynomials in T[x]/(x^n - omega), where n is
+  // a power of 3. The result is placed in `to`.
+  void mul(T *p, T *q, uint64_t n, T *to) {
+    if (n <= 27) {
+      for (uint64_t i = 0; i < n; ++i) {
+        to[i]=0;
+      }
+      muladd(p, q, n, to);
+      return;
+    }
+    Trace::Span span(trace, "mul", n, depth, out ? (to - out)/n : 0);
+    const T *parent = out;
+    out = to + 2*n;
+    ++depth;
+
+    uint64_t m = 1;
+    while (m*m < n) {
+      m *= 3;
+    }
+    uint64_t r = n/m;
+
+    T inv = 1;
+    for (uint64_t i = 1; i < r; i *= 3) {
+      inv *= INV3;
+    }
+
+    /**********************************************************
+     * THE PRODUCT IN (T[x]/(x^m - omega))[y] / (y^r - omega) *
+     **********************************************************/
+
+    // Move to the ring (T[x]/(x^m - omega))[y]/(y^r - 1) via the map y -> x^(m/r) y
+    for (uint64_t i = 0; i < r; ++i) {
+      twiddle(p + m*i, m, m/r*i, to + m*i);
+      twiddle(q + m*i, m, m/r*i, to + n + m*i);
+    }
+
+    // Multiply using FFT
+    convolve(to, to + n, m, r, to + 2*n);
+    for (uint64_t i = 0; i < n; ++i) {
+      to[2*n + i] *= inv;
+    }
+
+    // Return to the ring (T[x]/(x^m - omega))[y]/(y^r - omega)
+    for (uint64_t i = 0; i < r; ++i) {
+      twiddle(to + 2*n + m*i, m, 3*m - m/r*i, to + n + m*i);
+    }
+
+    /************************************************************
+     * THE PRODUCT IN (T[x]/(x^m - omega^2))[y] / (y^r - omega) *
+     ************************************************************/
+
+    // Use conjugation to move to the ring (T[x]/(x^m - omega))[y]/(y^r - omega^2).
+    // Then move to (T[x]/(x^m - omega))[y]/(y^r - 1) via the map y -> x^(2m/r) y
+    for (uint64_t i = 0; i < r; ++i) {
+      for (uint64_t j = 0; j < m; ++j) {
+        p[m*i + j] = p[m*i + j].conj();
+        q[m*i + j] = q[m*i + j].conj();
+      }
+      twiddle(p + m*i, m, 2*m/r*i, to + m*i);
+      twiddle(q + m*i, m, 2*m/r*i, p + m*i);
+    }
+
+    convolve(to, p, m, r, to + 2*n);
+    for (uint64_t i = 0; i < n; ++i) {
+      to[2*n + i] *= inv;
+    }
+
+    for (uint64_t i = 0; i < r; ++i) {
+      twiddle(to + 2*n + m*i, m, 3*m - 2*m/r*i, q + m*i);
+    }
+
+    /**************************************************************************
+     * The product in (T[x]/(x^(2m) + x^m + 1))[y]/(y^r - omega) via CRT, and *
+     * unravelling the substitution y = x^m at the same time.                 *
+     **************************************************************************/
+
+    --depth;
+    out = parent;
+    crt(to + n, q, n, m, to);
+  }
+
+  // Adds the product of p and q in T[x]/(x^n - omega) to `to`, using O(n^2)
+  // grade-school multiplication.
+  void muladd(const T *p, const T *q, uint64_t n, T *to) {
+    for (uint64_t i = 0; i < n; ++i) {
+      for (uint64_t j = 0; j < n - i; ++j) {
+        to[i + j] += p[i]*q[j];
+      }
+      for (uint64_t j = n - i; j < n; ++j) {
+        to[i + j - n] += p[i]*q[j]*OMEGA;
+      }
+    }
+  }
+
+  // The last step of mul: given the product u in
+  // (T[x]/(x^m - omega))[y]/(y^r - omega) and the conjugate v of the product
+  // in (T[x]/(x^m - omega^2))[y]/(y^r - omega), places the product in
+  // T[x]/(x^n - omega) in `to`.
+  void crt(T *u, T *v, uint64_t n, uint64_t m, T *to) {
+    uint64_t r = n/m;
+    for (uint64_t i = 0; i < n; ++i) {
+      to[i] = 0;
+    }
+    for (uint64_t i = 0; i < r; ++i) {
+      for (uint64_t j = 0; j < m; ++j) {
+        to[i*m + j] += (1 - OMEGA)*u[i*m + j] + (1 - OMEGA2)*v[i*m + j].conj();
+        if (i*m + m + j < n) {
+          to[i*m + m + j] += (OMEGA2 - OMEGA)*(u[i*m + j] - v[i*m + j].conj());
+        } else {
+          to[i*m + m + j - n] += (1 - OMEGA2)*(u[i*m + j] - v[i*m + j].conj());
+        }
+      }
+    }
+    for (uint64_t i = 0; i < n; ++i) {
+      to[i] *= INV3;
+    }
+  }
+
+  /*
+   * Spectra. The operands of mul go through a fixed linear map on their way
+   * down the recursion: in each of the two branches they are twiddled,
+   * transformed by fftdif, and each block is handed to the next level, until
+   * the blocks are small enough for grade-school multiplication. We call the
+   * collection of these leaf blocks the spectrum of the operand. Multiplying
+   * leaf blocks pairwise gives the spectrum of the product, and running the
+   * second half of mul on it (fftdit, twiddles and CRT at each level) gives
+   * the product itself.
+   *
+   * A spectrum is larger than the polynomial it comes from, by a factor of 2
+   * for each level of the recursion, but it only has to be computed once for
+   * an operand that takes part in many products.
+   */
+
+  // The two sizes below are those of the mul recursion: the size m of the
+  // blocks it splits a polynomial of size n into and, at the bottom, the size
+  // of the leaf blocks.
+  uint64_t block_size(uint64_t n) {
+    uint64_t m = 1;
+    while (m*m < n) {
+      m *= 3;
+    }
+    return m;
+  }
+
+  uint64_t leaf_size(uint64_t n) {
+    return n <= 27 ? n : leaf_size(block_size(n));
+  }
+
+  // The number of elements in the spectrum of a polynomial in
+  // T[x]/(x^n - omega).
+  uint64_t spectrum_size(uint64_t n) {
+    if (n <= 27) return n;
+    uint64_t m = block_size(n);
+    return 2*(n/m)*spectrum_size(m);
+  }
+
+  // The memory mul(p, q, n, to) uses from `to` onwards: its output, the two
+  // operands of its convolves and their output, after which the mul of the
+  // last block puts its own scratch.
+  uint64_t mul_size(uint64_t n) {
+    if (n <= 27) return n;
+    uint64_t m = block_size(n);
+    return 3*n - m + mul_size(m);
+  }
+
+  // The number of elements in the Spectrum of a polynomial in R[x]/(x^n - 1).
+  uint64_t spectrum_length(uint64_t n) {
+    uint64_t m = cyclic_block_size(n);
+    return n/m*spectrum_size(m);
+  }
+
+  // Whether n is a power of three.
+  static bool power_of_three(uint64_t n) {
+    uint64_t k = 1;
+    while (k < n && k <= ~0ull/3) {
+      k *= 3;
+    }
+    return k == n;
+  }
+
+  // Throws a runtime_error naming `caller` unless s is laid out as the
+  // spectrum of a polynomial in R[x]/(x^n - 1), n a power of three.
+  void check(SpectrumRef s, const string &caller) {
+    if (!power_of_three(s.n) || s.size < s.n ||
+        s.size != spectrum_length(s.n)) {
+      throw runtime_error(caller + ": not a spectrum for n = " +
+                          to_string(s.n) + " (" + to_string(s.size) +
+                          " elements)");
+    }
+  }
+
+  // The working memory needed by `transform` and `inverse`.
+  uint64_t work_size(uint64_t n) {
+    if (n <= 27) return 0;
+    return 3*n + work_size(block_size(n));
+  }
+
+  // Places the spectrum of p in T[x]/(x^n - omega) in `to`. p is destroyed.
+  void transform(T *p, uint64_t n, T *to, T *work) {
+    if (n <= 27) {
+      for (uint64_t i = 0; i < n; ++i) {
+        to[i] = p[i];
+      }
+      return;
+    }
+    uint64_t m = block_size(n);
+    uint64_t r = n/m;
+    uint64_t s = spectrum_size(m);
+    for (uint64_t i = 0; i < r; ++i) {
+      twiddle(p + m*i, m, m/r*i, work + m*i);
+    }
+    fftdif(work, m, r);
+    for (uint64_t i = 0; i < r; ++i) {
+      transform(work + m*i, m, to + s*i, work + n);
+    }
+    for (uint64_t i = 0; i < r; ++i) {
+      for (uint64_t j = 0; j < m; ++j) {
+        p[m*i + j] = p[m*i + j].conj();
+      }
+      twiddle(p + m*i, m, 2*m/r*i, work + m*i);
+    }
+    fftdif(work, m, r);
+    for (uint64_t i = 0; i < r; ++i) {
+      transform(work + m*i, m, to + s*(r + i), work + n);
+    }
+  }
+
+  // Multiplies the leaf blocks of two spectra of size s, for polynomials in
+  // T[x]/(x^n - omega), and adds the results to `to`.
+  void pointwise(const T *a, const T *b, uint64_t n, uint64_t s, T *to) {
+    uint64_t l = leaf_size(n);
+    for (uint64_t i = 0; i < s; i += l) {
+      muladd(a + i, b + i, l, to + i);
+    }
+  }
+
+  // Places the polynomial in T[x]/(x^n - omega) with spectrum `spec` in `to`.
+  void inverse(const T *spec, uint64_t n, T *to, T *work) {
+    if (n <= 27) {
+      for (uint64_t i = 0; i < n; ++i) {
+        to[i] = spec[i];
+      }
+      return;
+    }
+    uint64_t m = block_size(n);
+    uint64_t r = n/m;
+    uint64_t s = spectrum_size(m);
+    T inv = 1;
+    for (uint64_t i = 1; i < r; i *= 3) {
+      inv *= INV3;
+    }
+    T *u = work + n, *v = work + 2*n;
+    for (uint64_t i = 0; i < r; ++i) {
+      inverse(spec + s*i, m, work + m*i, work + 3*n);
+    }
+    fftdit(work, m, r);
+    for (uint64_t i = 0; i < r; ++i) {
+      for (uint64_t j = 0; j < m; ++j) {
+        work[m*i + j] *= inv;
+      }
+      twiddle(work + m*i, m, 3*m - m/r*i, u + m*i);
+    }
+    for (uint64_t i = 0; i < r; ++i) {
+      inverse(spec + s*(r + i), m, work + m*i, work + 3*n);
+    }
+    fftdit(work, m, r);
+    for (uint64_t i = 0; i < r; ++i) {
+      for (uint64_t j = 0; j < m; ++j) {
+        work[m*i + j] *= inv;
+      }
+      twiddle(work + m*i, m, 3*m - 2*m/r*i, v + m*i);
+    }
+    crt(u, v, n, m, to);
+  }
+
+  // If n = 3^k, returns m = 3^(floor(k/2)), so that r = n/m = 3^(ceil(k/2)).
+  uint64_t cyclic_block_size(uint64_t n) {
+    uint64_t m = 1;
+    while (m <= n/m) {
+      m *= 3;
+    }
+    return m/3;
+  }
+
+  // Runs f(c, i) for i = 0, ..., count - 1 on up to one thread per hardware
+  // thread, or on the scheduler if there is one. Each task is passed an
+  // engine c of its thread, as an engine's temporary space cannot be shared,
+  // with the same settings as this one. If a task throws, no further tasks
+  // are started and the first exception is rethrown once all threads are
+  // done.
+  template<class F>
+  void parallel(uint64_t count, F f) {
+    if (scheduler) {
+      scheduler->run(count, priority, [&](uint64_t i) {
+        Conv64 c = engine();
+        Trace::Span span(trace, "task", count, 0, i);
+        f(c, i);
+      });
+      return;
+    }
+    uint64_t threads = min<uint64_t>(count, max(1u, thread::hardware_concurrency()));
+    atomic<uint64_t> next(0);
+    vector<exception_ptr> failed(threads);
+    vector<thread> pool;
+    for (uint64_t t = 0; t < threads; ++t) {
+      pool.emplace_back([&, t]() {
+        try {
+          Conv64 c = engine();
+          for (uint64_t i; (i = next++) < count; ) {
+            Trace::Span span(trace, "task", count, 0, i);
+            f(c, i);
+          }
+        } catch (...) {
+          failed[t] = current_exception();
+          next = count;
+        }
+      });
+    }
+    for (thread &t : pool) {
+      t.join();
+    }
+    for (exception_ptr &e : failed) {
+      if (e) rethrow_exception(e);
+    }
+  }
+
+  // Returns a new engine with the same settings as this one.
+  Conv64 engine() {
+    Conv64 c;
+    c.trace = trace;
+    c.repetitions = repetitions;
+    c.scheduler = scheduler;
+    c.priority = priority;
+    c.budget = budget;
+    return c;
+  }
+
+  // Operands with at most this many coefficients are multiplied by `direct`
+  // rather than by a transform of the whole product. Direct convolution
+  // stayed faster up to this size with the other operand anywhere between
+  // 10^3 and 10^6 coefficients.
+  static const uint64_t DIRECT_MAX = 256;
+
+  // How multiply_linear computes a product: the algorithm, the transform
+  // length, and the lengths of the pieces of p and q it is cut into.
+  struct Plan {
+    Algorithm algorithm;
+    uint64_t length, pchunk, qchunk;
+  };
+
+  // Places the product of p and q in R[x] in target, or adds it to target if
+  // `add` is set, as planned by `planned`.
+  template<class I, class J>
+  void multiply_linear(const I *p, uint64_t plen, const J *q, uint64_t qlen,
+                       uint64_t *target, bool add, const Plan &plan) {
+    if (plan.algorithm == CYCLIC) {
+      multiply_cyclic_raw(p, plen, q, qlen, plan.length, target,
+                          plen + qlen - 1, add);
+    } else if (plan.algorithm == CHUNKED) {
+      if (!add) {
+        fill(target, target + plen + qlen - 1, 0);
+      }
+      for (uint64_t i = 0; i < plen; i += plan.pchunk) {
+        for (uint64_t j = 0; j < qlen; j += plan.qchunk) {
+          uint64_t a = min(plan.pchunk, plen - i), b = min(plan.qchunk, qlen - j);
+          multiply_linear(p + i, a, q + j, b, target + i + j, true,
+                          planned(a, b, 0));
+        }
+      }
+    } else if (qlen <= DIRECT_MAX) {
+      direct(p, plen, q, qlen, target, add);
+    } else {
+      direct(q, qlen, p, plen, target, add);
+    }
+  }
+
+  // The smallest transform length worth cutting a product into.
+  static const uint64_t CHUNK_MIN = 2187;
+
+  // Plans a product of operands of plen and qlen coefficients, when
+  // `reserved` bytes of the budget are already taken by its result. Of the
+  // single cyclic product and the cuts into pieces of each shorter power of
+  // three length, picks the one whose workspace fits and that the cost model
+  // of estimate predicts to be fastest. A piece cuts only the longer operand
+  // if the shorter one leaves room for it, so a very unbalanced product is
+  // cut even without a budget, into pieces of a length close to that of the
+  // short operand.
+  Plan planned(uint64_t plen, uint64_t qlen, uint64_t reserved) {
+    if (budget && reserved > budget) {
+      throw runtime_error("multiply: the result needs " + to_string(reserved) +
+                          " bytes, over the memory budget of " +
+                          to_string(budget));
+    }
+    uint64_t avail = budget ? budget - reserved : ~0ull;
+    uint64_t s = cyclic_length(plen, qlen);
+    if (s == 0) {
+      return {DIRECT, 0, plen, qlen};
+    }
+    Plan best = {CYCLIC, 0, plen, qlen};
+    double best_cost = 0;
+    for (uint64_t t = s; t == s || t >= CHUNK_MIN; t /= 3) {
+      if (cyclic_bytes(t) > avail) continue;
+      Plan plan = {CHUNKED, t, (t + 1)/2, (t + 1)/2};
+      if (t == s) {
+        plan = {CYCLIC, s, plen, qlen};
+      } else if (qlen <= t/2) {
+        plan = {CHUNKED, t, t - qlen + 1, qlen};
+      } else if (plen <= t/2) {
+        plan = {CHUNKED, t, plen, t - plen + 1};
+      }
+      uint64_t levels = 0;
+      for (uint64_t i = 1; i < t; i *= 3) {
+        ++levels;
+      }
+      double cost = (double)t*levels*((plen + plan.pchunk - 1)/plan.pchunk)*
+                    ((qlen + plan.qchunk - 1)/plan.qchunk);
+      if (best.length == 0 || cost < best_cost) {
+        best = plan;
+        best_cost = cost;
+      }
+    }
+    if (best.length == 0) {
+      uint64_t t = s;
+      while (t > CHUNK_MIN) {
+        t /= 3;
+      }
+      throw runtime_error("multiply: a product of " + to_string(plen) +
+                          " by " + to_string(qlen) + " coefficients needs " +
+                          to_string(reserved + cyclic_bytes(t)) +
+                          " bytes, over the memory budget of " +
+                          to_string(budget));
+    }
+    return best;
+  }
+
+  // The memory multiply_cyclic_raw allocates for a product of length n.
+  uint64_t cyclic_bytes(uint64_t n) {
+    return (3*n + 7*cyclic_block_size(n))*sizeof(T);
+  }
+
+  // The length of the cyclic product multiply_linear uses for operands of
+  // plen and qlen coefficients, or 0 if it uses direct convolution.
+  uint64_t cyclic_length(uint64_t plen, uint64_t qlen) {
+    if (plen <= DIRECT_MAX || qlen <= DIRECT_MAX) {
+      return 0;
+    }
+    uint64_t s = 1;
+    while (s < plen + qlen - 1) {
+      s *= 3;
+    }
+    return s;
+  }
+
+  // The best time of three products of p and q, in seconds.
+  double best_of(const vector<int64_t> &p, const vector<int64_t> &q) {
+    double best = 1e9;
+    for (int rep = 0; rep < 3; ++rep) {
+      auto start = chrono::steady_clock::now();
+      multiply(p, q);
+      best = min(best, chrono::duration<double>(chrono::steady_clock::now() -
+                                                start).count());
+    }
+    return best;
+  }
+
+  // Direct convolution for a short q. The outputs are produced in blocks of
+  // 8 consecutive positions whose sums stay in registers while q is swept,
+  // and away from the ends of p the inner loop has no bounds checks, so that
+  // it can be vectorised over the output positions.
+  template<class I, class J>
+  void direct(const I *p, uint64_t plen, const J *q, uint64_t qlen,
+              uint64_t *target, bool add) {
+    const uint64_t B = 8;
+    uint64_t len = plen + qlen - 1;
+    Trace::Span span(trace, "direct", len);
+    for (uint64_t k = 0; k < len; k += B) {
+      uint64_t acc[B] = {0};
+      if (k + 1 >= qlen && k + B <= plen) {
+        for (uint64_t j = 0; j < qlen; ++j) {
+          uint64_t c = (int64_t)q[j];
+          const I *src = p + k - j;
+          for (uint64_t b = 0; b < B; ++b) {
+            acc[b] += (uint64_t)(int64_t)src[b]*c;
+          }
+        }
+      } else {
+        for (uint64_t b = 0; b < B && k + b < len; ++b) {
+          uint64_t i = k + b;
+          uint64_t j0 = i + 1 > plen ? i + 1 - plen : 0;
+          for (uint64_t j = j0; j < qlen && j <= i; ++j) {
+            acc[b] += (uint64_t)(int64_t)p[i - j]*(uint64_t)(int64_t)q[j];
+          }
+        }
+      }
+      for (uint64_t b = 0; b < B && k + b < len; ++b) {
+        target[k + b] = add ? target[k + b] + acc[b] : acc[b];
+      }
+    }
+  }
+
+  // Coefficient i of an input with len coefficients, widened to 64 bits.
+  template<class I>
+  T load(const I *p, uint64_t len, uint64_t i) {
+    return i < len ? T((uint64_t)(int64_t)p[i]) : T();
+  }
+
+  // Returns p(x), for x in R or in T.
+  template<class I, class X>
+  X evaluate(const vector<I> &p, X x) {
+    X v = 0;
+    for (uint64_t i = p.size(); i-- > 0; ) {
+      v = v*x + X((uint64_t)(int64_t)p[i]);
+    }
+    return v;
+  }
+
+  // Computes the product of two polynomials from the ring R[x]/(x^n - 1), where
+  // n must be a power of three. The inputs have plen and qlen <= n
+  // coefficients, the others being zero. The first len <= n coefficients of
+  // the result are placed in target, or added to it if `add` is set.
+  template<class I, class J>
+  void multiply_cyclic_raw(const I *p, uint64_t plen, const J *q,
+                           uint64_t qlen, uint64_t n, uint64_t *target,
+                           uint64_t len, bool add) {
+    uint64_t m = cyclic_block_size(n);
+    uint64_t r = n/m;
+
+    // Compute 3^(-r)
+    T inv = 1;
+    for (uint64_t i = 1; i < r; i *= 3) {
+      inv *= INV3;
+    }
+
+    // Allocate some working memory, the layout is as follows:
+    // pp: length n
+    // qq: length n
+    // to: length n + 3*m
+    // tmp: length 4*m
+    T *buf = new T[3*n + 7*m];
+    T *pp = buf;
+    T *qq = buf + n;
+    T *to = buf + 2*n;
+    tmp = buf + 3*n + 3*m;
+    Trace::Span span(trace, "cyclic", n);
+    out = to;
 
     // By setting y = x^m, we may write our polynomials in the form
     //   (p_0 + p_1 x + ... + p_{m-1} x^{m-1})
@@ -347,43 +2236,1650 @@ class Conv64 {
     // where S = R[x]/(x^m - omega), and since r <= 3m, we know that x^{3m/r} is
     // an rth root of unity. We can therefore use FFT to calculate the product
     // in S[y]/(y^r - 1).
-    fftdif(pp, m, r);
-    fftdif(qq, m, r);
+    //
+    // The inputs are only read by the first level of butterflies, which loads
+    // and widens the three blocks it combines right before working on them.
+    if (r == 1) {
+      pp[0] = load(p, plen, 0);
+      qq[0] = load(q, qlen, 0);
+      convolve(pp, qq, m, r, to);
+    } else {
+      {
+        Trace::Span span(trace, "load", n);
+        for (uint64_t i = 0; i < r/3; ++i) {
+          for (uint64_t k = i*m; k < n; k += n/3) {
+            for (uint64_t j = k; j < k + m; ++j) {
+              pp[j] = load(p, plen, j);
+              qq[j] = load(q, qlen, j);
+            }
+          }
+          difrow2(pp, qq, m, r, i);
+        }
+      }
+      Trace::Span convolving(trace, "convolve", n);
+      convolve_thirds(pp, qq, m, r, to);
+    }
+    Trace::Span extracting(trace, "extract", n);
+    for (uint64_t i = 0; i<n; ++i) {
+      pp[i] = to[i]*inv;
+    }
+    extract(pp, n, m, to, target, len, add);
+
+    delete[] buf;
+  }
+
+  // The last step of a cyclic product: given the product in
+  // (T[x]/(x^m - omega))[y]/(y^r - 1) in `pp`, places the first len
+  // coefficients of the product in R[x]/(x^n - 1) in target, or adds them to
+  // target if `add` is set. `to` is used as scratch space of size n.
+  void extract(T *pp, uint64_t n, uint64_t m, T *to, uint64_t *target,
+               uint64_t len, bool add) {
+    uint64_t r = n/m;
+    for (uint64_t i = 0; i < r; ++i) {
+      extract_block(pp + i*m, pp + ((i + r - 1) % r)*m, m, to + i*m);
+    }
+    if (add) {
+      for (uint64_t i = 0; i < len; ++i) {
+        target[i] += (to[i]*INV3).a;
+      }
+    } else {
+      for (uint64_t i = 0; i < len; ++i) {
+        target[i] = (to[i]*INV3).a;
+      }
+    }
+  }
+
+  // Block i of `to` in extract, before the division by 3, from blocks i and
+  // i - 1 (cyclically) of pp.
+  //
+  // The product in (T[x]/(x^m - omega^2))[y](y^r - 1) is simply the
+  // conjugate of the product in (T[x]/(x^m - omega))[y]/(y^r - 1), because
+  // there is no omega-component in the data.
+  //
+  // By the Chinese Remainder Theorem we can obtain the product in the
+  // ring (T[x]/(x^(2m) + x^m + x))[y]/(y^r - 1), and then set y=x^m to get
+  // the result. Setting y=x^m moves the upper half of block i - 1 onto
+  // block i.
+  void extract_block(T *cur, T *prev, uint64_t m, T *to) {
+    for (uint64_t j = 0; j < m; ++j) {
+      to[j] = (1 - OMEGA)*cur[j] + (1 - OMEGA2)*cur[j].conj() +
+              (OMEGA2 - OMEGA)*(prev[j] - prev[j].conj());
+    }
+  }
+};
+
+/*
+ * Multiplication spread over several machines.
+ *
+ * multiply_cyclic_raw views its operands as r blocks of length m, and we
+ * further view the block indices as an r1 x r2 matrix, block i*r2 + c being
+ * in row i and column c. The first log_3(r1) levels of fftdif only combine
+ * blocks within a column, and what is left after them is an independent
+ * convolve on every row. So each of W workers
+ *
+ *   1. gets a slab of columns and runs the first levels of fftdif on it,
+ *   2. exchanges blocks with all other workers so that it ends up with a
+ *      slab of rows (the transpose),
+ *   3. runs convolve, i.e. the remaining fftdif levels, the pointwise
+ *      products and the first fftdit levels, on each of its rows,
+ *   4. transposes back and runs the last fftdit levels on its columns,
+ *   5. scales and extracts the coefficients of its columns, for which it
+ *      needs the last column of the worker to its left,
+ *
+ * and sends its coefficients of the product to the coordinator. r1 is the
+ * smallest power of three that gives every worker a row. The coordinator
+ * widens the operands one row of a slab at a time as it sends them, so
+ * apart from the operands and the result it only holds one row of blocks.
+ *
+ * All messages are raw native-endian words, so all machines must share the
+ * same architecture.
+ */
+class Distributed {
+  public:
+
+  // Runs a worker listening on `port`, serving one product after another. A
+  // product that fails, for instance because a peer went away, is reported
+  // on stderr and the worker goes on with the next one.
+  static void serve(uint16_t port) {
+    int lfd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(lfd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (lfd < 0 || bind(lfd, (sockaddr*)&addr, sizeof(addr)) < 0 ||
+        listen(lfd, 64) < 0) {
+      throw runtime_error("cannot listen on port " + to_string(port));
+    }
+    for (;;) {
+      try {
+        work(lfd);
+      } catch (const exception &e) {
+        cerr << "worker: " << e.what() << '\n';
+      }
+    }
+  }
+
+  // Returns the product of p and q, computed by the workers at the given
+  // "host:port" addresses. Products too small to give every worker a row
+  // are computed locally.
+  static vector<int64_t> multiply(const vector<int64_t> &p,
+                                  const vector<int64_t> &q,
+                                  const vector<string> &workers) {
+    Conv64 c;
+    uint64_t len = p.size() + q.size() - 1;
+    uint64_t n = 1;
+    while (n < len) {
+      n *= 3;
+    }
+    uint64_t m = c.cyclic_block_size(n), r = n/m, w = workers.size();
+    uint64_t r1 = 1;
+    while (r1 < w) {
+      r1 *= 3;
+    }
+    if (r1 > r) {
+      return c.multiply(p, q);
+    }
+    uint64_t r2 = r/r1;
+
+    vector<uint64_t> header = {n, m, r1, w, 0, len};
+    for (const string &a : workers) {
+      header.push_back(address(a));
+    }
+    Sockets fds;
+    for (uint64_t k = 0; k < w; ++k) {
+      fds.push_back(connect_to(header[HEADER + k], COORDINATOR));
+      header[4] = k;
+      send_words(fds[k], header.data(), header.size());
+      uint64_t c0 = k*r2/w, c1 = (k + 1)*r2/w;
+      vector<T> row((c1 - c0)*m);
+      for (const vector<int64_t> *x : {&p, &q}) {
+        for (uint64_t i = 0; i < r1; ++i) {
+          for (uint64_t j = 0; j < row.size(); ++j) {
+            row[j] = c.load(x->data(), x->size(), (i*r2 + c0)*m + j);
+          }
+          send_all(fds[k], row.data(), row.size()*sizeof(T));
+        }
+      }
+    }
+    vector<int64_t> res(len);
+    for (uint64_t k = 0; k < w; ++k) {
+      uint64_t c0 = k*r2/w, c1 = (k + 1)*r2/w;
+      for (uint64_t i = 0; i < r1; ++i) {
+        uint64_t from = (i*r2 + c0)*m, to = min((i*r2 + c1)*m, len);
+        if (from < to) {
+          recv_all(fds[k], res.data() + from, (to - from)*sizeof(int64_t));
+        }
+      }
+    }
+    return res;
+  }
+
+  private:
+
+  // The first word sent on a connection: the rank of the sending worker, or
+  // COORDINATOR.
+  static const uint64_t COORDINATOR = ~0ull;
+
+  // The number of words the coordinator sends before the worker addresses:
+  // n, m, r1, the number of workers, the rank of the receiver and the
+  // length of the product.
+  static const uint64_t HEADER = 6;
+
+  // The sockets of one product, closed however it ends.
+  struct Sockets : vector<int> {
+    ~Sockets() {
+      for (int fd : *this) {
+        if (fd >= 0) close(fd);
+      }
+    }
+  };
+
+  // Packs "a.b.c.d:port" into a word.
+  static uint64_t address(const string &a) {
+    size_t colon = a.rfind(':');
+    in_addr ip;
+    if (colon == string::npos ||
+        inet_pton(AF_INET, a.substr(0, colon).c_str(), &ip) != 1) {
+      throw runtime_error("bad worker address " + a);
+    }
+    return (uint64_t)ntohl(ip.s_addr) << 16 | stoul(a.substr(colon + 1));
+  }
+
+  static int connect_to(uint64_t a, uint64_t rank) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(a >> 16);
+    addr.sin_port = htons(a & 0xffff);
+    if (fd < 0 || connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+      if (fd >= 0) close(fd);
+      throw runtime_error("cannot connect to worker");
+    }
+    try {
+      send_words(fd, &rank, 1);
+    } catch (...) {
+      close(fd);
+      throw;
+    }
+    return fd;
+  }
+
+  // Accepts a connection on lfd and reads the rank it starts with. Returns
+  // -1 for a connection that closes before sending one.
+  static int accept_rank(int lfd, uint64_t &rank) {
+    int fd = accept(lfd, nullptr, nullptr);
+    if (fd < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) return -1;
+      throw runtime_error(string("accept failed: ") + strerror(errno));
+    }
+    try {
+      recv_all(fd, &rank, sizeof(rank));
+    } catch (const runtime_error &) {
+      close(fd);
+      return -1;
+    }
+    return fd;
+  }
+
+  static void send_all(int fd, const void *buf, uint64_t len) {
+    for (const char *b = (const char*)buf; len > 0; ) {
+      ssize_t k = send(fd, b, len, MSG_NOSIGNAL);
+      if (k <= 0) throw runtime_error("connection lost");
+      b += k;
+      len -= k;
+    }
+  }
+
+  static void recv_all(int fd, void *buf, uint64_t len) {
+    for (char *b = (char*)buf; len > 0; ) {
+      ssize_t k = recv(fd, b, len, 0);
+      if (k <= 0) throw runtime_error("connection lost");
+      b += k;
+      len -= k;
+    }
+  }
+
+  static void send_words(int fd, const uint64_t *w, uint64_t k) {
+    send_all(fd, w, k*sizeof(uint64_t));
+  }
+
+  // Serves one product on the listening socket lfd. Other workers may
+  // connect before the coordinator does. Connections that do not belong to
+  // the product are dropped.
+  static void work(int lfd) {
+    Sockets fds;
+    int cfd = -1;
+    vector<pair<uint64_t, int>> peers;
+    while (cfd < 0) {
+      uint64_t rank;
+      int fd = accept_rank(lfd, rank);
+      if (fd < 0) continue;
+      fds.push_back(fd);
+      if (rank == COORDINATOR) {
+        cfd = fd;
+      } else {
+        peers.push_back({rank, fd});
+      }
+    }
+    uint64_t header[HEADER];
+    recv_all(cfd, header, sizeof(header));
+    uint64_t n = header[0], m = header[1], r1 = header[2], w = header[3];
+    uint64_t me = header[4], len = header[5];
+    if (m == 0 || n % m || r1 == 0 || (n/m) % r1 || w == 0 || w > r1 ||
+        me >= w || len > n) {
+      throw runtime_error("bad job header");
+    }
+    uint64_t r = n/m, r2 = r/r1;
+    vector<uint64_t> addrs(w);
+    recv_all(cfd, addrs.data(), w*sizeof(uint64_t));
+
+    // Our columns are [c0, c1), and our rows [i0, i1).
+    uint64_t c0 = me*r2/w, c1 = (me + 1)*r2/w, cw = c1 - c0;
+    uint64_t i0 = me*r1/w, i1 = (me + 1)*r1/w, rows = i1 - i0;
+
+    Conv64 c;
+    // cols: length 2*r1*cw*m, the column slab of both operands
+    // pp, qq: length rows*r2*m each, the row slab of both operands
+    // to: length rows*r2*m + 3*m
+    // tmp: length 4*m
+    uint64_t cn = r1*cw*m, rn = rows*r2*m;
+    vector<T> buf(2*cn + 3*rn + 7*m);
+    T *cols = buf.data(), *pp = cols + 2*cn, *qq = pp + rn, *to = qq + rn;
+    c.tmp = to + rn + 3*m;
+    recv_all(cfd, cols, 2*cn*sizeof(T));
+
+    // The block of the column slab in row i and column k.
+    auto col = [&](T *base, uint64_t i, uint64_t k) {
+      return base + (i*cw + k - c0)*m;
+    };
+
+    // The first fftdif levels, on our columns.
+    for (uint64_t R = r; R > r2; R /= 3) {
+      for (uint64_t o = 0; o < r; o += R) {
+        for (uint64_t i = 0; i < R/3; i += r2) {
+          for (uint64_t k = c0; k < c1; ++k) {
+            uint64_t b = o + i + k, rr = R/3;
+            c.difbutterfly2(col(cols, b/r2, k), col(cols, (b + rr)/r2, k),
+                            col(cols, (b + 2*rr)/r2, k),
+                            col(cols + cn, b/r2, k), col(cols + cn, (b + rr)/r2, k),
+                            col(cols + cn, (b + 2*rr)/r2, k), m, 3*(i + k)*m/R);
+          }
+        }
+      }
+    }
+
+    // Connect to the other workers, and wait for them to connect to us.
+    vector<int> out(w, -1), in(w, -1);
+    for (uint64_t v = 0; v < w; ++v) {
+      if (v != me) {
+        out[v] = connect_to(addrs[v], me);
+        fds.push_back(out[v]);
+      }
+    }
+    for (const pair<uint64_t, int> &e : peers) {
+      if (e.first < w && e.first != me && in[e.first] < 0) {
+        in[e.first] = e.second;
+      }
+    }
+    uint64_t got = w - count(in.begin(), in.end(), -1);
+    while (got < w - 1) {
+      uint64_t rank;
+      int fd = accept_rank(lfd, rank);
+      if (fd < 0) continue;
+      fds.push_back(fd);
+      if (rank == COORDINATOR) {
+        throw runtime_error("new job before the current one finished");
+      }
+      if (rank < w && rank != me && in[rank] < 0) {
+        in[rank] = fd;
+        ++got;
+      }
+    }
+
+    // Transpose: send worker v the part of our columns in its rows, and
+    // receive the part of our rows in its columns.
+    exchange(out, in, me, [&](uint64_t v, vector<T> &msg) {
+      for (uint64_t i = v*r1/w; i < (v + 1)*r1/w; ++i) {
+        msg.insert(msg.end(), col(cols, i, c0), col(cols, i, c1));
+        msg.insert(msg.end(), col(cols + cn, i, c0), col(cols + cn, i, c1));
+      }
+    }, [&](uint64_t v, const T *msg) {
+      uint64_t k0 = v*r2/w, k1 = (v + 1)*r2/w;
+      for (uint64_t i = i0; i < i1; ++i) {
+        uint64_t at = ((i - i0)*r2 + k0)*m, len = (k1 - k0)*m;
+        copy(msg, msg + len, pp + at);
+        copy(msg + len, msg + 2*len, qq + at);
+        msg += 2*len;
+      }
+    });
+
+    // Everything in between, on our rows.
+    for (uint64_t i = 0; i < rows; ++i) {
+      c.convolve(pp + i*r2*m, qq + i*r2*m, m, r2, to + i*r2*m);
+    }
+
+    // Transpose back, into the first half of `cols`.
+    exchange(out, in, me, [&](uint64_t v, vector<T> &msg) {
+      uint64_t k0 = v*r2/w, k1 = (v + 1)*r2/w;
+      for (uint64_t i = 0; i < rows; ++i) {
+        msg.insert(msg.end(), to + (i*r2 + k0)*m, to + (i*r2 + k1)*m);
+      }
+    }, [&](uint64_t v, const T *msg) {
+      for (uint64_t i = v*r1/w; i < (v + 1)*r1/w; ++i) {
+        copy(msg, msg + cw*m, col(cols, i, c0));
+        msg += cw*m;
+      }
+    });
+
+    // The last fftdit levels, on our columns.
+    for (uint64_t R = 3*r2; R <= r; R *= 3) {
+      for (uint64_t o = 0; o < r; o += R) {
+        for (uint64_t i = 0; i < R/3; i += r2) {
+          for (uint64_t k = c0; k < c1; ++k) {
+            uint64_t b = o + i + k, rr = R/3;
+            c.ditbutterfly(col(cols, b/r2, k), col(cols, (b + rr)/r2, k),
+                           col(cols, (b + 2*rr)/r2, k), m, 3*(i + k)*m/R);
+          }
+        }
+      }
+    }
+
+    // Block i*r2 + c0 of the result also needs block i*r2 + c0 - 1, the last
+    // column of the worker owning column c0 - 1, or for c0 = 0 block
+    // (i - 1)*r2 + r2 - 1 of the previous row. Workers without columns take
+    // no part.
+    auto owner = [&](uint64_t k) {
+      uint64_t v = 0;
+      while ((v + 1)*r2/w <= k) {
+        ++v;
+      }
+      return v;
+    };
+    vector<T> halo(r1*m);
+    exchange(out, in, me, [&](uint64_t v, vector<T> &msg) {
+      if (cw == 0 || v != owner(c1 % r2)) return;
+      for (uint64_t i = 0; i < r1; ++i) {
+        msg.insert(msg.end(), col(cols, i, c1 - 1), col(cols, i, c1 - 1) + m);
+      }
+    }, [&](uint64_t v, const T *msg) {
+      if (cw == 0 || v != owner((c0 + r2 - 1) % r2)) return;
+      for (uint64_t i = 0; i < r1; ++i) {
+        uint64_t from = c0 == 0 ? (i + r1 - 1) % r1 : i;
+        copy(msg + from*m, msg + (from + 1)*m, halo.data() + i*m);
+      }
+    });
+
+    T inv = 1;
+    for (uint64_t i = 1; i < r; i *= 3) {
+      inv *= INV3;
+    }
+    for (uint64_t i = 0; i < cn; ++i) {
+      cols[i] *= inv;
+    }
+    for (T &x : halo) {
+      x *= inv;
+    }
+    vector<uint64_t> res(cw*m);
+    for (uint64_t i = 0; i < r1; ++i) {
+      uint64_t from = (i*r2 + c0)*m, end = min((i*r2 + c1)*m, len);
+      if (from >= end) continue;
+      for (uint64_t k = c0; k < c1; ++k) {
+        c.extract_block(col(cols, i, k),
+                        k > c0 ? col(cols, i, k - 1) : halo.data() + i*m, m,
+                        col(cols + cn, i, k));
+      }
+      T *row = col(cols + cn, i, c0);
+      for (uint64_t j = 0; j < end - from; ++j) {
+        res[j] = (row[j]*INV3).a;
+      }
+      send_all(cfd, res.data(), (end - from)*sizeof(uint64_t));
+    }
+  }
+
+  // An all-to-all exchange: pack(v, msg) appends what goes to worker v to
+  // msg, and unpack(v, msg) handles what came from v. Receiving runs on one
+  // thread per peer, so that no send can block forever on a full buffer.
+  template<class Pack, class Unpack>
+  static void exchange(const vector<int> &out, const vector<int> &in,
+                       uint64_t me, Pack pack, Unpack unpack) {
+    uint64_t w = out.size();
+    vector<vector<T>> got(w);
+    vector<exception_ptr> failed(w);
+    vector<thread> receivers;
+    for (uint64_t v = 0; v < w; ++v) {
+      if (v == me) continue;
+      receivers.emplace_back([&, v]() {
+        try {
+          uint64_t len;
+          recv_all(in[v], &len, sizeof(len));
+          got[v].resize(len);
+          recv_all(in[v], got[v].data(), len*sizeof(T));
+        } catch (...) {
+          failed[v] = current_exception();
+        }
+      });
+    }
+    exception_ptr sending;
+    try {
+      for (uint64_t v = 0; v < w; ++v) {
+        vector<T> msg;
+        pack(v, msg);
+        if (v == me) {
+          got[v].swap(msg);
+          continue;
+        }
+        uint64_t len = msg.size();
+        send_words(out[v], &len, 1);
+        send_all(out[v], msg.data(), len*sizeof(T));
+      }
+    } catch (...) {
+      sending = current_exception();
+    }
+    for (thread &t : receivers) {
+      t.join();
+    }
+    if (sending) rethrow_exception(sending);
+    for (uint64_t v = 0; v < w; ++v) {
+      if (failed[v]) rethrow_exception(failed[v]);
+    }
+    for (uint64_t v = 0; v < w; ++v) {
+      unpack(v, got[v].data());
+    }
+  }
+};
+
+/*
+ * An alternative to the Radix-3 approach above. Instead of avoiding the
+ * division by 2 of a Radix-2 inverse FFT, we postpone it: all arithmetic is
+ * done on 128-bit words, i.e. modulo 2^128, and the inverse transforms are
+ * left unscaled. The result is then 2^k times the product, modulo 2^128, for
+ * a k that only depends on the length, and as long as k <= 64, shifting it
+ * right by k bits gives the product modulo 2^64. k never exceeds the base 2
+ * logarithm of the length, so this always holds.
+ *
+ * The transforms follow Schönhage: a polynomial in U[x]/(x^n + 1), U being
+ * the integers modulo 2^128 and n = m*r a power of two, is cut into r blocks
+ * of m coefficients, each padded to an element of U[x]/(x^2m + 1). There x
+ * is a 4m'th root of unity, which gives the 2r'th roots needed for a
+ * negacyclic FFT of length r <= 2m. The pointwise products are again
+ * negacyclic products, of length 2m, handled recursively.
+ *
+ * Every level pads by a factor of 2 and multiplies 128-bit words, against the
+ * factor 2 for the conjugate branch and 64-bit pairs of the Radix-3 engine,
+ * but the power of two lengths waste less on padding the input.
+ */
+class Conv64Radix2 {
+  public:
+
+  // Returns the product of two polynomials from the ring R[x].
+  vector<int64_t> multiply(const vector<int64_t> &p,
+                           const vector<int64_t> &q) {
+    uint64_t len = p.size() + q.size() - 1;
+    uint64_t n = 1;
+    while (n < len) {
+      n *= 2;
+    }
+    uint64_t k = shift(n);
+
+    // pp: length n
+    // qq: length n
+    // to: length n
+    // work: length work_size(n)
+    // tmp: length max(2*sqrt(n), n)
+    uint64_t t = max(n, 2*block_size(n));
+    U *buf = new U[3*n + work_size(n) + t];
+    U *pp = buf, *qq = buf + n, *to = buf + 2*n, *work = buf + 3*n;
+    tmp = work + work_size(n);
+    for (uint64_t i = 0; i < n; ++i) {
+      pp[i] = i < p.size() ? (uint64_t)p[i] : 0;
+      qq[i] = i < q.size() ? (uint64_t)q[i] : 0;
+    }
+    negmul(pp, qq, n, to, work);
+    vector<int64_t> res(len);
+    for (uint64_t i = 0; i < len; ++i) {
+      res[i] = (uint64_t)(to[i] >> k);
+    }
+    delete[] buf;
+    return res;
+  }
+
+  private:
+
+  typedef unsigned __int128 U;
+
+  // Temporary space.
+  U *tmp;
+
+  // The block size m used to split a polynomial of size n = m*r.
+  uint64_t block_size(uint64_t n) {
+    uint64_t m = 1;
+    while (4*m*m <= n) {
+      m *= 2;
+    }
+    return m;
+  }
+
+  // The power of two that negmul multiplies its result by.
+  uint64_t shift(uint64_t n) {
+    if (n <= 32) return 0;
+    uint64_t m = block_size(n), k = 0;
+    for (uint64_t r = n/m; r > 1; r /= 2) {
+      ++k;
+    }
+    return k + shift(2*m);
+  }
+
+  // The working memory needed by negmul.
+  uint64_t work_size(uint64_t n) {
+    if (n <= 32) return 0;
+    return 6*n + work_size(2*block_size(n));
+  }
+
+  // Returns the product of a polynomial and the monomial x^t in the ring
+  // U[x]/(x^m + 1). The result is placed in `to`.
+  // NOTE: t must be in the range [0, 2m)
+  void rotate(U *p, uint64_t m, uint64_t t, U *to) {
+    bool neg = t >= m;
+    if (neg) {
+      t -= m;
+    }
+    for (uint64_t j = 0; j < t; ++j) {
+      to[j] = neg ? p[m - t + j] : -p[m - t + j];
+    }
+    for (uint64_t j = t; j < m; ++j) {
+      to[j] = neg ? -p[j - t] : p[j - t];
+    }
+  }
+
+  // A "Decimation In Frequency" In-Place Radix-2 FFT Routine.
+  // Input: A polynomial from (U[x]/(x^m + 1))[y]/(y^r - 1), r <= 2m.
+  // Output: Its Fourier transform (w.r.t. y) in bit-reversed order.
+  void fftdif(U *p, uint64_t m, uint64_t r) {
+    if (r == 1) return;
+    uint64_t rr = r/2, pos = m*rr;
+    for (uint64_t i = 0; i < rr; ++i) {
+      for (uint64_t j = 0; j < m; ++j) {
+        U u = p[i*m + j], v = p[pos + i*m + j];
+        p[i*m + j] = u + v;
+        tmp[j] = u - v;
+      }
+      rotate(tmp, m, 2*m/r*i, p + pos + i*m);
+    }
+    fftdif(p, m, rr);
+    fftdif(p + pos, m, rr);
+  }
+
+  // A "Decimation In Time" In-Place Radix-2 Inverse FFT Routine, without the
+  // division by r.
+  // Input: A polynomial from (U[x]/(x^m + 1))[y]/(y^r - 1) with coefficients
+  //        in bit-reversed order.
+  // Output: r times its inverse Fourier transform in normal order.
+  void fftdit(U *p, uint64_t m, uint64_t r) {
+    if (r == 1) return;
+    uint64_t rr = r/2, pos = m*rr;
+    fftdit(p, m, rr);
+    fftdit(p + pos, m, rr);
+    for (uint64_t i = 0; i < rr; ++i) {
+      rotate(p + pos + i*m, m, i == 0 ? 0 : 2*m - 2*m/r*i, tmp);
+      for (uint64_t j = 0; j < m; ++j) {
+        U u = p[i*m + j];
+        p[i*m + j] = u + tmp[j];
+        p[pos + i*m + j] = u - tmp[j];
+      }
+    }
+  }
+
+  // Computes 2^shift(n) times the product of two polynomials in
+  // U[x]/(x^n + 1), where n is a power of 2. The result is placed in `to`,
+  // and p and q are destroyed.
+  void negmul(U *p, U *q, uint64_t n, U *to, U *work) {
+    if (n <= 32) {
+      // O(n^2) grade-school multiplication
+      for (uint64_t i = 0; i < n; ++i) {
+        to[i] = 0;
+      }
+      for (uint64_t i = 0; i < n; ++i) {
+        for (uint64_t j = 0; j < n - i; ++j) {
+          to[i + j] += p[i]*q[j];
+        }
+        for (uint64_t j = n - i; j < n; ++j) {
+          to[i + j - n] -= p[i]*q[j];
+        }
+      }
+      return;
+    }
+
+    // With y = x^m we are working in (U[x]/(x^2m + 1))[y]/(y^r + 1). The map
+    // y -> x^(2m/r) y takes us to (U[x]/(x^2m + 1))[y]/(y^r - 1).
+    uint64_t m = block_size(n), r = n/m, mm = 2*m;
+    U *pp = work, *qq = work + 2*n, *c = work + 4*n, *next = work + 6*n;
+    for (uint64_t i = 0; i < r; ++i) {
+      for (uint64_t j = 0; j < m; ++j) {
+        tmp[j] = p[i*m + j];
+        tmp[m + j] = 0;
+      }
+      rotate(tmp, mm, mm/r*i, pp + mm*i);
+      for (uint64_t j = 0; j < m; ++j) {
+        tmp[j] = q[i*m + j];
+        tmp[m + j] = 0;
+      }
+      rotate(tmp, mm, mm/r*i, qq + mm*i);
+    }
+    fftdif(pp, mm, r);
+    fftdif(qq, mm, r);
     for (uint64_t i = 0; i < r; ++i) {
-      mul(pp + i*m, qq + i*m, m, to + i*m);
+      negmul(pp + mm*i, qq + mm*i, mm, c + mm*i, next);
     }
-    fftdit(to, m, r);
-    for (uint64_t i = 0; i<n; ++i) {
-      pp[i] = to[i]*inv;
+    fftdit(c, mm, r);
+
+    // Undo the substitution and set y = x^m, where x^n = -1.
+    for (uint64_t i = 0; i < n; ++i) {
+      to[i] = 0;
     }
-    
-    // Now, the product in (T[x]/(x^m - omega^2))[y](y^r - 1) is simply the
-    // conjugate of the product in (T[x]/(x^m - omega))[y]/(y^r - 1), because
-    // there is no omega-component in the data.
-    //
-    // By the Chinese Remainder Theorem we can obtain the product in the
-    // ring (T[x]/(x^(2m) + x^m + x))[y]/(y^r - 1), and then set y=x^m to get
-    // the result.
-    for (uint64_t i = 0; i < n; ++i) to[i] = 0;
     for (uint64_t i = 0; i < r; ++i) {
-      for (uint64_t j = 0; j < m; ++j) {
-        to[i*m + j] += (1 - OMEGA)*pp[i*m + j] + (1 - OMEGA2)*pp[i*m + j].conj();
-        if (i*m + m + j < n) {
-          to[i*m + m + j] += (OMEGA2 - OMEGA)*(pp[i*m + j] - pp[i*m + j].conj());
+      rotate(c + mm*i, mm, i == 0 ? 0 : 2*mm - mm/r*i, tmp);
+      for (uint64_t j = 0; j < mm; ++j) {
+        if (i*m + j < n) {
+          to[i*m + j] += tmp[j];
         } else {
-          to[i*m + m + j - n] += (OMEGA2 - OMEGA) * (pp[i*m + j] - pp[i*m + j].conj());
+          to[i*m + j - n] -= tmp[j];
         }
       }
     }
-    for (uint64_t i = 0; i < n; ++i) {
-      target[i] = (to[i]*INV3).a;
+  }
+};
+
+/*
+ * When the coefficients of p and q only become known one at a time, and
+ * coefficient k of p*q is needed before p_{k+1} and q_{k+1} can be supplied,
+ * we cannot simply call `multiply`. Instead we use the relaxed multiplication
+ * of van der Hoeven.
+ *
+ * The grid of products p_i q_j is tiled by squares of side s = 2^e: for every
+ * s, the square [s-1, 2s-1) x [s-1, 2s-1) on the diagonal, and the squares
+ * [s-1, 2s-1) x [ts-1, (t+1)s-1) for t >= 2 together with their mirror
+ * images. Such a square only involves coefficients with index at most
+ * (t+1)s - 2, which is also the lowest coefficient of p*q it contributes to,
+ * so it can be added in as soon as that coefficient is requested. Each step
+ * does O(1) products of every size s dividing k + 2, which adds up to
+ * O(M(n) log n) for n coefficients, M(n) being the cost of `multiply`.
+ */
+class RelaxedMultiplier {
+  public:
+
+  // Supplies p_k and q_k, where k is the number of earlier calls, and returns
+  // coefficient k of p*q.
+  int64_t next(int64_t a, int64_t b) {
+    uint64_t k = p.size();
+    p.push_back(a);
+    q.push_back(b);
+    for (uint64_t s = 1; (k + 2) % s == 0 && 2*s <= k + 2; s *= 2) {
+      if (c.size() < k + 2*s - 1) {
+        c.resize(2*(k + 2*s - 1));
+      }
+      uint64_t j = k + 1 - s;
+      if (j == s - 1) {
+        add_product(p.data() + s - 1, q.data() + s - 1, s, k);
+      } else {
+        add_product(p.data() + s - 1, q.data() + j, s, k);
+        add_product(q.data() + s - 1, p.data() + j, s, k);
+      }
     }
+    return c[k];
+  }
 
-    delete[] buf;
+  private:
+
+  // Below this size, blocks are multiplied directly.
+  static const uint64_t DIRECT = 32;
+
+  Conv64 conv;
+  vector<int64_t> p, q;
+  vector<uint64_t> c;
+
+  // Adds the product of u[0..s) and v[0..s) to c, starting at index `at`.
+  void add_product(const int64_t *u, const int64_t *v, uint64_t s, uint64_t at) {
+    if (s <= DIRECT) {
+      for (uint64_t i = 0; i < s; ++i) {
+        for (uint64_t j = 0; j < s; ++j) {
+          c[at + i + j] += (uint64_t)u[i]*(uint64_t)v[j];
+        }
+      }
+      return;
+    }
+    vector<int64_t> res = conv.multiply(vector<int64_t>(u, u + s),
+                                        vector<int64_t>(v, v + s));
+    for (uint64_t i = 0; i < res.size(); ++i) {
+      c[at + i] += res[i];
+    }
+  }
+};
+
+/*
+ * Maintains the product p*q for a fixed q while p receives sparse updates.
+ * A change of k coefficients of p, spanning L consecutive indices, changes
+ * the product by delta*q. That costs k*|q| operations directly, or a
+ * product of the span of delta by q, or a transform of the span, a
+ * pointwise product and an inverse once the spectrum of q has been
+ * computed. Each update takes whichever the cost model of Conv64::estimate
+ * predicts to be cheapest.
+ */
+class IncrementalProduct {
+  public:
+
+  IncrementalProduct(const vector<int64_t> &p, const vector<int64_t> &q,
+                     const Conv64::Options &options = Conv64::Options())
+      : plen(p.size()), q(q), res(conv.multiply(p, q)), options(options) {
+    n = 1;
+    levels = 0;
+    while (n < res.size()) {
+      n *= 3;
+      ++levels;
+    }
+    qs.n = 0;
+  }
+
+  // Adds d to p_i for each pair (i, d) in delta, where i < p.size(), and
+  // updates the product accordingly.
+  void add(const vector<pair<uint64_t, int64_t>> &delta) {
+    if (delta.empty()) {
+      return;
+    }
+    uint64_t lo = plen, hi = 0;
+    for (const pair<uint64_t, int64_t> &e : delta) {
+      lo = min(lo, e.first);
+      hi = max(hi, e.first + 1);
+    }
+    uint64_t span = hi - lo;
+
+    // A transform of length n costs about a third of a cyclic product.
+    double direct = options.direct*delta.size()*q.size();
+    double product = conv.estimate(span, q.size(), options).seconds;
+    double cached = options.cyclic*n*levels*(qs.n ? 2 : 3)/3;
+    if (direct <= product && direct <= cached) {
+      for (const pair<uint64_t, int64_t> &e : delta) {
+        uint64_t *r = (uint64_t*)res.data() + e.first;
+        for (uint64_t j = 0; j < q.size(); ++j) {
+          r[j] += (uint64_t)e.second*(uint64_t)q[j];
+        }
+      }
+      return;
+    }
+
+    vector<int64_t> d(span);
+    for (const pair<uint64_t, int64_t> &e : delta) {
+      d[e.first - lo] = (uint64_t)d[e.first - lo] + e.second;
+    }
+    if (product <= cached) {
+      conv.multiply_add(d, q, res.data() + lo);
+      return;
+    }
+    // The span times q fits in length n, so its cyclic product does not
+    // wrap around and only needs to be shifted to lo.
+    if (qs.n == 0) {
+      qs = conv.transform(q, n);
+    }
+    vector<int64_t> dq = conv.multiply_cyclic(conv.transform(d, n), qs);
+    for (uint64_t i = 0; i < span + q.size() - 1; ++i) {
+      res[lo + i] = (uint64_t)res[lo + i] + dq[i];
+    }
+  }
+
+  // The current value of p*q.
+  const vector<int64_t> &product() const {
+    return res;
+  }
+
+  private:
+
+  Conv64 conv;
+  uint64_t plen, n, levels;
+  vector<int64_t> q, res;
+  Conv64::Options options;
+  // The spectrum of q in R[x]/(x^n - 1), computed on the first update that
+  // needs it.
+  Conv64::Spectrum qs;
+};
+
+/*
+ * Multiplication modulo a fixed monic polynomial f of degree d, by Barrett
+ * reduction. With rev_k(c) = x^k c(1/x) the coefficients of c in reverse
+ * order, the quotient q of a product c of degree <= 2d - 2 by f satisfies
+ *
+ *     rev_(d-2)(q) = rev_(2d-2)(c) * g  mod x^(d-1),  g = rev_d(f)^(-1),
+ *
+ * and the remainder is c - q*f, of degree < d. Since f is monic, rev_d(f) has
+ * constant term 1, and g follows from the Newton iteration
+ *
+ *     g <- g + g (1 - rev_d(f) g),
+ *
+ * which doubles the number of correct coefficients per step. The spectra of
+ * g and f are kept, so a modular product costs the product itself and two
+ * more, each with one forward transform instead of two.
+ *
+ * The product of two polynomials of degree < d - 1 modulo x^(d-1) needs a
+ * cyclic product of length >= 2d - 3 to be free of wraparound, but q*f only
+ * needs length N >= d: as c = q*f + r with r of degree < d, r is c - q*f
+ * with both sides reduced modulo x^N - 1.
+ */
+class ModularContext {
+  public:
+
+  explicit ModularContext(const vector<int64_t> &f) {
+    if (f.empty() || f.back() != 1) {
+      throw runtime_error("ModularContext: f must be monic");
+    }
+    d = f.size() - 1;
+    n = nf = 1;
+    while (n + 1 < 2*d) {
+      n *= 3;
+    }
+    while (nf < d) {
+      nf *= 3;
+    }
+    fs = conv.transform(Conv64::fold(f.data(), f.size(), nf), nf);
+    if (d < 2) {
+      return;
+    }
+
+    uint64_t k = d - 1;
+    vector<int64_t> h(f.rbegin(), f.rend()), g = {1};
+    for (uint64_t len = 1; len < k; ) {
+      len = min(2*len, k);
+      vector<int64_t> e = conv.multiply(vector<int64_t>(h.begin(),
+                                                        h.begin() + len), g);
+      e.resize(len);
+      for (uint64_t i = 0; i < len; ++i) {
+        e[i] = -(uint64_t)e[i];
+      }
+      e[0] = (uint64_t)e[0] + 1;
+      vector<int64_t> t = conv.multiply(g, e);
+      g.resize(len);
+      for (uint64_t i = 0; i < len; ++i) {
+        g[i] = (uint64_t)g[i] + t[i];
+      }
+    }
+    gs = conv.transform(g, n);
+  }
+
+  // The degree of f.
+  uint64_t degree() const {
+    return d;
+  }
+
+  // Returns a*b mod f, as d coefficients, for a and b with at most d
+  // coefficients each.
+  vector<int64_t> multiply(const vector<int64_t> &a, const vector<int64_t> &b) {
+    if (a.size() > d || b.size() > d) {
+      throw runtime_error("ModularContext: an operand has more than " +
+                          to_string(d) + " coefficients");
+    }
+    if (d == 0) {
+      return {};
+    }
+    vector<int64_t> c = conv.multiply_cyclic(conv.transform(a, n),
+                                             conv.transform(b, n));
+    c.resize(2*d - 1);
+    return reduce(c);
+  }
+
+  // Returns c mod f, as d coefficients, for c with at most 2d - 1
+  // coefficients.
+  vector<int64_t> reduce(const vector<int64_t> &c) {
+    if (c.size() > max<uint64_t>(2*d, 1) - 1) {
+      throw runtime_error("ModularContext: " + to_string(c.size()) +
+                          " coefficients to reduce, more than " +
+                          to_string(max<uint64_t>(2*d, 1) - 1));
+    }
+    vector<int64_t> r(d);
+    if (c.size() <= d) {
+      copy(c.begin(), c.end(), r.begin());
+      return r;
+    }
+
+    uint64_t k = d - 1;
+    vector<int64_t> rc(k);
+    for (uint64_t i = 0; i < k && 2*d - 2 - i < c.size(); ++i) {
+      rc[i] = c[2*d - 2 - i];
+    }
+    vector<int64_t> rq = conv.multiply_cyclic(conv.transform(rc, n), gs);
+    vector<int64_t> q(k);
+    for (uint64_t i = 0; i < k; ++i) {
+      q[i] = rq[k - 1 - i];
+    }
+    vector<int64_t> qf = conv.multiply_cyclic(conv.transform(q, nf), fs);
+    vector<int64_t> cf = Conv64::fold(c.data(), c.size(), nf);
+    for (uint64_t i = 0; i < d; ++i) {
+      r[i] = (uint64_t)cf[i] - qf[i];
+    }
+    return r;
+  }
+
+  private:
+
+  Conv64 conv;
+  uint64_t d;
+  // The transform lengths of the products with g and with f.
+  uint64_t n, nf;
+  // The spectra of g = rev_d(f)^(-1) mod x^(d-1) in R[x]/(x^n - 1), and of f
+  // in R[x]/(x^nf - 1).
+  Conv64::Spectrum gs, fs;
+};
+
+/*
+ * Asynchronous file reads and writes for the command line driver, through
+ * io_uring, driven by raw system calls so that no library is needed. Where
+ * io_uring is not available (old kernels, seccomp filters), every operation
+ * is done at once with pread or pwrite instead, and nothing overlaps. The
+ * same goes for kernels 5.1 to 5.5, whose io_uring has no plain reads and
+ * writes, which is found by probing the opcodes, or failing that, by the
+ * first operation being rejected.
+ */
+class AsyncIO {
+  public:
+
+  AsyncIO() {
+    io_uring_params params = {};
+    ring = syscall(__NR_io_uring_setup, ENTRIES, &params);
+    if (ring < 0) {
+      return;
+    }
+    sq_bytes = params.sq_off.array + params.sq_entries*sizeof(unsigned);
+    cq_bytes = params.cq_off.cqes + params.cq_entries*sizeof(io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+      sq_bytes = cq_bytes = max(sq_bytes, cq_bytes);
+    }
+    sq = (char*)mmap(nullptr, sq_bytes, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQ_RING);
+    cq = params.features & IORING_FEAT_SINGLE_MMAP ? sq :
+         (char*)mmap(nullptr, cq_bytes, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_CQ_RING);
+    sqes = (io_uring_sqe*)mmap(nullptr, params.sq_entries*sizeof(io_uring_sqe),
+                               PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                               ring, IORING_OFF_SQES);
+    if (sq == MAP_FAILED || cq == MAP_FAILED || sqes == MAP_FAILED) {
+      close(ring);
+      ring = -1;
+      return;
+    }
+    sq_entries = params.sq_entries;
+    sqes_bytes = params.sq_entries*sizeof(io_uring_sqe);
+    sq_off = params.sq_off;
+    cq_off = params.cq_off;
+    if (!supported({IORING_OP_READ, IORING_OP_WRITE})) {
+      shutdown();
+    }
+  }
+
+  ~AsyncIO() {
+    // After an exception operations may still be in flight into buffers
+    // that are about to be freed.
+    while (ring >= 0 && inflight() > 0) {
+      reap();
+      if (inflight() > 0 &&
+          syscall(__NR_io_uring_enter, ring, 0, 1, IORING_ENTER_GETEVENTS,
+                  nullptr, 0) < 0 && errno != EINTR) {
+        break;
+      }
+    }
+    shutdown();
+  }
+
+  AsyncIO(const AsyncIO&) = delete;
+  AsyncIO &operator=(const AsyncIO&) = delete;
+
+  // Whether operations really run in the background.
+  bool asynchronous() {
+    return ring >= 0 && !plain;
+  }
+
+  // Starts reading len bytes at offset off of fd into buf, and returns a
+  // token for wait.
+  uint64_t read(int fd, void *buf, uint64_t len, uint64_t off) {
+    return start(IORING_OP_READ, fd, buf, len, off);
+  }
+
+  // Starts writing len bytes from buf at offset off of fd, and returns a
+  // token for wait.
+  uint64_t write(int fd, const void *buf, uint64_t len, uint64_t off) {
+    return start(IORING_OP_WRITE, fd, (void*)buf, len, off);
   }
+
+  // Waits for the operation with the given token to finish. Throws a
+  // runtime_error if it failed.
+  void wait(uint64_t token) {
+    Op &op = ops.at(token);
+    while (!op.done) {
+      reap();
+      if (!op.done) {
+        enter(0, 1, IORING_ENTER_GETEVENTS);
+      }
+    }
+    if (op.result == -EINVAL || op.result == -EOPNOTSUPP) {
+      // The opcode is not known to this kernel; do it all with pread or
+      // pwrite, and the following operations too.
+      plain = true;
+      op.result = 0;
+    }
+    if (op.result < 0) {
+      throw runtime_error(string("I/O failed: ") + strerror(-op.result));
+    }
+    // A transfer may stop short, in which case the rest is done at once.
+    transfer(op, op.result);
+    ops.erase(token);
+  }
+
+  private:
+
+  // The most operations in flight.
+  static const unsigned ENTRIES = 16;
+
+  struct Op {
+    uint8_t opcode;
+    int fd;
+    char *buf;
+    uint64_t len, off;
+    bool done;
+    int64_t result;
+  };
+
+  uint64_t start(uint8_t opcode, int fd, void *buf, uint64_t len,
+                 uint64_t off) {
+    uint64_t token = next++;
+    Op op = {opcode, fd, (char*)buf, len, off, false, 0};
+    if (ring < 0 || plain) {
+      op.done = true;
+      op.result = 0;
+      ops[token] = op;
+      return token;
+    }
+    // A single read or write moves less than 2^31 bytes.
+    len = min<uint64_t>(len, 1ull << 30);
+    while (inflight() >= sq_entries) {
+      reap();
+      if (inflight() >= sq_entries) {
+        enter(0, 1, IORING_ENTER_GETEVENTS);
+      }
+    }
+    unsigned *tail = (unsigned*)(sq + sq_off.tail);
+    unsigned t = *tail, i = t & *(unsigned*)(sq + sq_off.ring_mask);
+    io_uring_sqe &sqe = sqes[i];
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = opcode;
+    sqe.fd = fd;
+    sqe.addr = (uint64_t)buf;
+    sqe.len = len;
+    sqe.off = off;
+    sqe.user_data = token;
+    ((unsigned*)(sq + sq_off.array))[i] = i;
+    __atomic_store_n(tail, t + 1, __ATOMIC_RELEASE);
+    ops[token] = op;
+    ++submitted;
+    enter(1, 0, 0);
+    return token;
+  }
+
+  // Moves what is left of op after its first `done` bytes with pread or
+  // pwrite.
+  void transfer(const Op &op, uint64_t done) {
+    while (done < op.len) {
+      ssize_t k = op.opcode == IORING_OP_READ ?
+                  pread(op.fd, op.buf + done, op.len - done, op.off + done) :
+                  pwrite(op.fd, op.buf + done, op.len - done, op.off + done);
+      if (k < 0 && errno == EINTR) continue;
+      if (k <= 0) {
+        throw runtime_error(k == 0 ? "unexpected end of file" :
+                            string("I/O failed: ") + strerror(errno));
+      }
+      done += k;
+    }
+  }
+
+  void reap() {
+    unsigned *head = (unsigned*)(cq + cq_off.head);
+    unsigned h = *head;
+    unsigned t = __atomic_load_n((unsigned*)(cq + cq_off.tail), __ATOMIC_ACQUIRE);
+    unsigned mask = *(unsigned*)(cq + cq_off.ring_mask);
+    for (; h != t; ++h) {
+      io_uring_cqe &cqe = ((io_uring_cqe*)(cq + cq_off.cqes))[h & mask];
+      Op &op = ops.at(cqe.user_data);
+      op.done = true;
+      op.result = cqe.res;
+      ++completed;
+    }
+    __atomic_store_n(head, h, __ATOMIC_RELEASE);
+  }
+
+  // Whether the kernel supports all the given opcodes. Kernels without the
+  // probe (before 5.6) support neither reads nor writes.
+  bool supported(initializer_list<uint8_t> opcodes) {
+    const unsigned OPS = 256;
+    vector<char> buf(sizeof(io_uring_probe) + OPS*sizeof(io_uring_probe_op));
+    io_uring_probe *probe = (io_uring_probe*)buf.data();
+    if (syscall(__NR_io_uring_register, ring, IORING_REGISTER_PROBE, probe,
+                OPS) < 0) {
+      return false;
+    }
+    for (uint8_t opcode : opcodes) {
+      if (opcode > probe->last_op ||
+          !(probe->ops[opcode].flags & IO_URING_OP_SUPPORTED)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Unmaps and closes the ring, if there is one.
+  void shutdown() {
+    if (ring >= 0) {
+      munmap(sqes, sqes_bytes);
+      if (cq != sq) munmap(cq, cq_bytes);
+      munmap(sq, sq_bytes);
+      close(ring);
+      ring = -1;
+    }
+  }
+
+  void enter(unsigned submit, unsigned wait, unsigned flags) {
+    while (syscall(__NR_io_uring_enter, ring, submit, wait, flags, nullptr, 0) < 0) {
+      if (errno != EINTR) {
+        throw runtime_error(string("io_uring_enter failed: ") + strerror(errno));
+      }
+    }
+  }
+
+  unsigned inflight() {
+    return submitted - completed;
+  }
+
+  int ring = -1;
+  // Whether the ring turned out not to support our opcodes.
+  bool plain = false;
+  char *sq = nullptr, *cq = nullptr;
+  io_uring_sqe *sqes = nullptr;
+  uint64_t sq_bytes = 0, cq_bytes = 0, sqes_bytes = 0;
+  unsigned sq_entries = 0, submitted = 0, completed = 0;
+  io_sqring_offsets sq_off;
+  io_cqring_offsets cq_off;
+  uint64_t next = 0;
+  map<uint64_t, Op> ops;
 };
 
-int main(void) {
+// Multiplies the polynomials in the files p and q, each a raw array of
+// native 64-bit coefficients, and writes their product to `out` in the same
+// format. The longer operand is streamed in pieces that are multiplied by
+// the whole of the shorter one and added into a window of the result: while
+// a piece is multiplied, the next one is read and the finished part of the
+// result before it is written. The output must not be one of the inputs.
+int multiply_files(const string &p, const string &q, const string &out) {
+  struct Files : vector<int> {
+    ~Files() {
+      for (int fd : *this) {
+        if (fd >= 0) close(fd);
+      }
+    }
+  } fds;
+  struct stat st[3];
+  const string *names[3] = {&p, &q, &out};
+  for (int i = 0; i < 2; ++i) {
+    fds.push_back(open(names[i]->c_str(), O_RDONLY));
+    if (fds[i] < 0 || fstat(fds[i], &st[i]) < 0) {
+      throw runtime_error("cannot read " + *names[i]);
+    }
+    if (st[i].st_size % 8 != 0) {
+      throw runtime_error(*names[i] + " has " + to_string(st[i].st_size) +
+                          " bytes, not a whole number of coefficients");
+    }
+  }
+  // Truncated only once it is known not to be an input.
+  fds.push_back(open(out.c_str(), O_WRONLY | O_CREAT, 0644));
+  if (fds[2] < 0 || fstat(fds[2], &st[2]) < 0) {
+    throw runtime_error("cannot write " + out);
+  }
+  for (int i = 0; i < 2; ++i) {
+    if (st[i].st_dev == st[2].st_dev && st[i].st_ino == st[2].st_ino) {
+      throw runtime_error("the output " + out + " is the input " + *names[i]);
+    }
+  }
+  if (ftruncate(fds[2], 0) < 0) {
+    throw runtime_error("cannot write " + out);
+  }
+  int pfd = fds[0], qfd = fds[1], ofd = fds[2];
+  uint64_t plen = st[0].st_size/8, qlen = st[1].st_size/8;
+  if (plen < qlen) {
+    swap(pfd, qfd);
+    swap(plen, qlen);
+  }
+  if (qlen == 0) {
+    throw runtime_error("empty operand");
+  }
+
+  // Pieces of p of at least 2^20 coefficients keep the reads and writes
+  // large, and of at least qlen keep the products balanced.
+  uint64_t piece = max<uint64_t>(qlen, 1 << 20);
+  vector<int64_t> qv(qlen), pv[2], done[2];
+  vector<int64_t> window(piece + qlen - 1);
+  uint64_t reading = 0, writing[2];
+  bool pending[2] = {false, false};
+  Conv64 c;
+  // Declared after the buffers, so that it is destroyed, waiting for what
+  // is in flight, before they are.
+  AsyncIO io;
+  io.wait(io.read(qfd, qv.data(), qlen*8, 0));
+  pv[0].resize(min(piece, plen));
+  reading = io.read(pfd, pv[0].data(), pv[0].size()*8, 0);
+  for (uint64_t i = 0, k = 0; i < plen; i += piece, k ^= 1) {
+    io.wait(reading);
+    if (i + piece < plen) {
+      pv[k ^ 1].resize(min(piece, plen - i - piece));
+      reading = io.read(pfd, pv[k ^ 1].data(), pv[k ^ 1].size()*8,
+                        (i + piece)*8);
+    }
+    c.multiply_add(pv[k], qv, window.data());
+
+    // The first `piece` coefficients of the window are final.
+    uint64_t len = min(piece, plen + qlen - 1 - i);
+    if (pending[k]) {
+      io.wait(writing[k]);
+    }
+    done[k].assign(window.begin(), window.begin() + len);
+    writing[k] = io.write(ofd, done[k].data(), len*8, i*8);
+    pending[k] = true;
+    copy(window.begin() + len, window.end(), window.begin());
+    fill(window.end() - len, window.end(), 0);
+
+    if (i + piece >= plen && plen + qlen - 1 > i + len) {
+      uint64_t rest = plen + qlen - 1 - i - len;
+      io.wait(io.write(ofd, window.data(), rest*8, (i + len)*8));
+    }
+  }
+  for (int k = 0; k < 2; ++k) {
+    if (pending[k]) {
+      io.wait(writing[k]);
+    }
+  }
+  return 0;
+}
+
+// Times both engines on products of two random polynomials of each length,
+// taking the best of a few runs.
+int bench() {
+  Conv64 c;
+  Conv64Radix2 c2;
+  cout << "length\tradix-3\tradix-2\n";
+  for (uint64_t n = 1000; n <= 1000000; n *= 10) {
+    vector<int64_t> p(n), q(n);
+    for (uint64_t i = 0; i < n; ++i) {
+      p[i] = i*0x9e3779b97f4a7c15ull;
+      q[i] = i*0xc2b2ae3d27d4eb4full;
+    }
+    double best = 1e9, best2 = 1e9;
+    for (int rep = 0; rep < 3; ++rep) {
+      auto start = chrono::steady_clock::now();
+      c.multiply(p, q);
+      auto mid = chrono::steady_clock::now();
+      c2.multiply(p, q);
+      auto end = chrono::steady_clock::now();
+      best = min(best, chrono::duration<double>(mid - start).count());
+      best2 = min(best2, chrono::duration<double>(end - mid).count());
+    }
+    cout << n << '\t' << best << '\t' << best2 << '\n';
+  }
+  return 0;
+}
+
+// Multiplies two random polynomials of length n on the given workers, and
+// checks the result against a local product.
+int distributed(uint64_t n, const vector<string> &workers) {
+  vector<int64_t> p(n), q(n);
+  for (uint64_t i = 0; i < n; ++i) {
+    p[i] = i*0x9e3779b97f4a7c15ull;
+    q[i] = i*0xc2b2ae3d27d4eb4full;
+  }
+  auto start = chrono::steady_clock::now();
+  vector<int64_t> res = Distributed::multiply(p, q, workers);
+  auto end = chrono::steady_clock::now();
+  Conv64 c;
+  bool ok = res == c.multiply(p, q);
+  cout << (ok ? "ok " : "MISMATCH ")
+       << chrono::duration<double>(end - start).count() << '\n';
+  return ok ? 0 : 1;
+}
+
+// Writes a trace of a product of two random polynomials of length n, and of
+// one of them against a few filters on all threads, to the given file.
+int trace(uint64_t n, const string &file) {
+  vector<int64_t> p(n), q(n);
+  for (uint64_t i = 0; i < n; ++i) {
+    p[i] = i*0x9e3779b97f4a7c15ull;
+    q[i] = i*0xc2b2ae3d27d4eb4full;
+  }
+  vector<vector<int64_t>> filters;
+  for (uint64_t k = 1; k <= 8; ++k) {
+    filters.push_back(vector<int64_t>(q.begin(), q.begin() + k*n/16 + 1));
+  }
+  Trace t(1 << 24);
+  Conv64 c;
+  c.set_trace(&t);
+  c.multiply(p, q);
+  c.multiply_many(p, filters);
+  ofstream out(file);
+  t.write(out);
+  return out ? 0 : 1;
+}
+
+// Runs the calls in a workload log on the radix-3 or the radix-2 engine, with
+// random operands of the recorded shapes, and compares the total time with
+// the recorded one. The radix-2 engine only has multiply, so the other calls
+// are skipped on it.
+int replay(const string &file, const string &engine) {
+  vector<Recorder::Call> calls = Recorder::read(file);
+  mt19937_64 rng(1);
+  Conv64 c;
+  Conv64Radix2 c2;
+  double recorded = 0, replayed = 0;
+  uint64_t skipped = 0;
+  for (const Recorder::Call &call : calls) {
+    vector<vector<int64_t>> ops;
+    for (const Recorder::Operand &o : call.operands) {
+      ops.push_back(Recorder::generate(o, rng));
+    }
+    bool linear = call.entry == Recorder::MULTIPLY ||
+                  call.entry == Recorder::MULTIPLY_ADD;
+    bool pair = linear || call.entry == Recorder::MULTIPLY_T ||
+                call.entry == Recorder::MULTIPLY_RANGE ||
+                call.entry == Recorder::MULTIPLY_EXACT;
+    if (pair && (ops[0].empty() || ops[1].empty())) {
+      continue;
+    }
+    if (engine == "radix-2" && !linear) {
+      ++skipped;
+      continue;
+    }
+
+    // The spectra the spectral entries start from, for a random polynomial
+    // of length n.
+    uint64_t n = call.args[0];
+    bool spectral = call.entry == Recorder::MULTIPLY_ADD_SPECTRA ||
+                    call.entry == Recorder::INVERSE ||
+                    call.entry == Recorder::MULTIPLY_CYCLIC;
+    Conv64::Spectrum a = {n, {}};
+    if (spectral) {
+      a = c.transform(Recorder::generate({n, n, 64}, rng), n);
+    }
+    Conv64::Spectrum acc = a;
+
+    vector<T> pt, qt;
+    if (call.entry == Recorder::MULTIPLY_T) {
+      for (uint64_t i = 0; i < 2; ++i) {
+        vector<int64_t> b = Recorder::generate(call.operands[i], rng);
+        vector<T> &t = i ? qt : pt;
+        for (uint64_t j = 0; j < b.size(); ++j) {
+          t.push_back(T(ops[i][j], b[j]));
+        }
+      }
+    }
+    Conv64::Matrix ma(call.args[0], vector<vector<int64_t>>(call.args[1]));
+    Conv64::Matrix mb(call.args[1], vector<vector<int64_t>>(call.args[2]));
+    if (call.entry == Recorder::MULTIPLY_MATRIX) {
+      uint64_t i = 0;
+      for (auto &row : ma) {
+        for (auto &e : row) {
+          e = move(ops[i++]);
+        }
+      }
+      for (auto &row : mb) {
+        for (auto &e : row) {
+          e = move(ops[i++]);
+        }
+      }
+    }
+    vector<vector<int64_t>> ps, qs;
+    for (uint64_t i = 0; call.entry == Recorder::MULTIPLY_BATCH &&
+                         i < ops.size(); i += 2) {
+      ps.push_back(ops[i]);
+      qs.push_back(ops[i + 1]);
+    }
+
+    auto start = chrono::steady_clock::now();
+    switch (call.entry) {
+      case Recorder::MULTIPLY:
+        if (engine == "radix-2") {
+          c2.multiply(ops[0], ops[1]);
+        } else {
+          c.multiply(ops[0], ops[1]);
+        }
+        break;
+      case Recorder::MULTIPLY_ADD:
+        if (engine == "radix-2") {
+          c2.multiply(ops[0], ops[1]);
+        } else {
+          vector<int64_t> res(ops[0].size() + ops[1].size() - 1);
+          c.multiply_add(ops[0], ops[1], res.data());
+        }
+        break;
+      case Recorder::MULTIPLY_T:
+        c.multiply_T(pt, qt);
+        break;
+      case Recorder::MULTIPLY_RANGE:
+        c.multiply_range(ops[0], ops[1], call.args[0], call.args[1]);
+        break;
+      case Recorder::MULTIPLY_EXACT:
+        c.multiply_exact(ops[0], ops[1]);
+        break;
+      case Recorder::MULTIPLY_MANY:
+        c.multiply_many(ops[0], vector<vector<int64_t>>(ops.begin() + 1,
+                                                        ops.end()));
+        break;
+      case Recorder::MULTIPLY_BATCH:
+        c.multiply_batch(ps, qs);
+        break;
+      case Recorder::MULTIPLY_MATRIX:
+        c.multiply(ma, mb);
+        break;
+      case Recorder::TRANSFORM:
+        c.transform(ops[0], n);
+        break;
+      case Recorder::MULTIPLY_ADD_SPECTRA:
+        c.multiply_add(a, a, acc);
+        break;
+      case Recorder::INVERSE:
+        c.inverse(a);
+        break;
+      case Recorder::MULTIPLY_CYCLIC:
+        c.multiply_cyclic(a, a);
+        break;
+      default:
+        throw runtime_error(file + " has a call of unknown entry " +
+                            to_string(call.entry));
+    }
+    recorded += call.seconds;
+    replayed += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  }
+  cout << calls.size() << " calls, recorded " << recorded << " s, replayed on "
+       << engine << ' ' << replayed << " s";
+  if (skipped) {
+    cout << ", " << skipped << " skipped";
+  }
+  cout << '\n';
+  return 0;
+}
+
+// The exact product of p and q by grade-school multiplication.
+vector<__int128> schoolbook(const vector<int64_t> &p, const vector<int64_t> &q) {
+  vector<__int128> res(p.size() + q.size() - 1);
+  for (uint64_t i = 0; i < p.size(); ++i) {
+    for (uint64_t j = 0; j < q.size(); ++j) {
+      res[i + j] += (__int128)p[i]*q[j];
+    }
+  }
+  return res;
+}
+
+// Checks multiply and multiply_exact against grade-school products, on
+// full-width inputs whose exact products stay below 2^124, and that
+// MappedSpectrum rejects damaged files.
+int check() {
+  mt19937_64 rng(1);
+  Conv64 c;
+  bool ok = true;
+  auto test = [&](const string &name, const vector<int64_t> &p,
+                  const vector<int64_t> &q) {
+    vector<__int128> expected = schoolbook(p, q);
+    vector<__int128> exact = c.multiply_exact(p, q);
+    vector<int64_t> wrapped = c.multiply(p, q);
+    bool pass = exact == expected;
+    for (uint64_t i = 0; i < expected.size(); ++i) {
+      pass = pass && wrapped[i] == (int64_t)(uint64_t)expected[i];
+    }
+    cout << (pass ? "ok " : "FAIL ") << name << '\n';
+    ok = ok && pass;
+  };
+  auto random = [&](uint64_t n, int bits) {
+    vector<int64_t> p(n);
+    for (int64_t &x : p) {
+      x = (int64_t)rng() >> (64 - bits);
+    }
+    return p;
+  };
+  test("extremes", {INT64_MIN, INT64_MAX, -1, INT64_MIN}, {1, -1, 3});
+  test("full width by signs", random(2000, 64), random(1000, 2));
+  test("full width by short", random(3000, 64), random(100, 50));
+  test("56 bits", random(1000, 56), random(1500, 56));
+
+  // A saved spectrum must load, and truncated or corrupted copies of it
+  // must be rejected rather than read out of bounds.
+  string file = "/tmp/conv64-check-" + to_string(getpid()) + ".spec";
+  c.save(c.transform(random(100, 64), 243), file);
+  string good;
+  {
+    ifstream in(file, ios::binary);
+    good.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+  }
+  auto load = [&](const string &name, const string &contents, bool valid) {
+    ofstream(file, ios::binary) << contents;
+    bool loaded = true;
+    try {
+      Conv64::MappedSpectrum s(file);
+    } catch (const runtime_error &) {
+      loaded = false;
+    }
+    cout << (loaded == valid ? "ok " : "FAIL ") << name << '\n';
+    ok = ok && loaded == valid;
+  };
+  auto header = [&](uint64_t word, uint64_t value) {
+    string bad = good;
+    memcpy(&bad[8*word], &value, 8);
+    return bad;
+  };
+  load("spectrum file", good, true);
+  load("truncated spectrum", good.substr(0, good.size() - 16), false);
+  load("spectrum header only", good.substr(0, 64), false);
+  load("short spectrum header", good.substr(0, 40), false);
+  load("spectrum of n = 2^64 - 1", header(2, ~0ull), false);
+  load("spectrum of n = 3^40", header(2, 12157665459056928801ull), false);
+  load("spectrum of n = 242", header(2, 242), false);
+  load("spectrum with a wrong size", header(3, good.size()/16), false);
+  remove(file.c_str());
+  return ok ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1 && string(argv[1]) == "bench") {
+    return bench();
+  }
+  if (argc > 1 && string(argv[1]) == "check") {
+    return check();
+  }
+  if (argc > 3 && string(argv[1]) == "trace") {
+    return trace(stoull(argv[2]), argv[3]);
+  }
+  if (argc > 4 && string(argv[1]) == "multiply") {
+    try {
+      return multiply_files(argv[2], argv[3], argv[4]);
+    } catch (const exception &e) {
+      cerr << "conv64: " << e.what() << '\n';
+      return 1;
+    }
+  }
+  if (argc > 2 && string(argv[1]) == "replay") {
+    return replay(argv[2], argc > 3 ? argv[3] : "radix-3");
+  }
+  if (argc > 2 && string(argv[1]) == "worker") {
+    try {
+      Distributed::serve(stoi(argv[2]));
+      return 0;
+    } catch (const exception &e) {
+      cerr << "conv64: " << e.what() << '\n';
+      return 1;
+    }
+  }
+  if (argc > 3 && string(argv[1]) == "distributed") {
+    return distributed(stoull(argv[2]), vector<string>(argv + 3, argv + argc));
+  }
+
   Conv64 c;
   vector<int64_t> in1(500000), in2(500000);
   for (int64_t i = 0; i < 500000; ++i) {
@@ -0,0 +1,203 @@
+/*
+ * Generates codelets.h, which holds straight-line versions of fftdif and
+ * fftdit from conv64.cpp for a few fixed block lengths m and block counts r:
+ *
+ *     g++ -O2 gen_codelets.cpp -o gen_codelets && ./gen_codelets > codelets.h
+ *
+ * With m and r fixed, every twiddle amount is a constant, so multiplying a
+ * block by x^t is only a renaming of its coefficients, with a multiplication
+ * by omega or omega^2 for those that wrap around. And in T, these are cheap:
+ *
+ *     omega*(a + b omega) = -b + (a - b) omega
+ *     omega^2*(a + b omega) = (b - a) - a omega
+ *
+ * Negations are not emitted but carried as a sign on each value, and folded
+ * into the additions that use it.
+ */
+
+#include<iostream>
+#include<string>
+#include<utility>
+#include<vector>
+
+using namespace std;
+
+// A 64-bit value of the generated code, possibly negated.
+struct V {
+  string name;
+  bool neg;
+};
+
+// An element of T, as the values of its two components.
+struct E {
+  V a, b;
+};
+
+class Generator {
+  public:
+
+  Generator(ostream &out) : out(out) { }
+
+  // Emits a function that runs fftdif on r blocks of length m.
+  void fftdif(uint64_t m, uint64_t r) {
+    vector<E> p = begin("fftdif", m, r);
+    dif(p, 0, m, r);
+    end(p);
+  }
+
+  // Emits a function that runs fftdit on r blocks of length m.
+  void fftdit(uint64_t m, uint64_t r) {
+    vector<E> p = begin("fftdit", m, r);
+    dit(p, 0, m, r);
+    end(p);
+  }
+
+  private:
+
+  ostream &out;
+  uint64_t next;
+
+  vector<E> begin(const string &name, uint64_t m, uint64_t r) {
+    out << "\n// " << name << "(p, " << m << ", " << r << ").\n";
+    out << "inline void " << name << "_" << m << "_" << r << "(T *p) {\n";
+    next = 0;
+    vector<E> p(m*r);
+    for (uint64_t i = 0; i < m*r; ++i) {
+      p[i].a = emit("p[" + to_string(i) + "].a");
+      p[i].b = emit("p[" + to_string(i) + "].b");
+    }
+    return p;
+  }
+
+  void end(const vector<E> &p) {
+    for (uint64_t i = 0; i < p.size(); ++i) {
+      out << "  p[" << i << "] = T(" << value(p[i].a) << ", "
+          << value(p[i].b) << ");\n";
+    }
+    out << "}\n";
+  }
+
+  V emit(const string &expr) {
+    string name = "v" + to_string(next++);
+    out << "  uint64_t " << name << " = " << expr << ";\n";
+    return {name, false};
+  }
+
+  static string value(const V &v) {
+    return v.neg ? "-" + v.name : v.name;
+  }
+
+  static V negate(V v) {
+    v.neg = !v.neg;
+    return v;
+  }
+
+  V add(const V &x, const V &y) {
+    if (x.neg == y.neg) {
+      V v = emit(x.name + " + " + y.name);
+      v.neg = x.neg;
+      return v;
+    }
+    return x.neg ? emit(y.name + " - " + x.name) : emit(x.name + " - " + y.name);
+  }
+
+  V sub(const V &x, const V &y) {
+    return add(x, negate(y));
+  }
+
+  // Returns omega^k*u.
+  E rotate(const E &u, uint64_t k) {
+    switch (k % 3) {
+      case 1: return {negate(u.b), sub(u.a, u.b)};
+      case 2: return {sub(u.b, u.a), negate(u.a)};
+      default: return u;
+    }
+  }
+
+  // Multiplies the block of length m at p[at] by x^t modulo x^m - omega.
+  void twiddle(vector<E> &p, uint64_t at, uint64_t m, uint64_t t) {
+    t %= 3*m;
+    vector<E> block(p.begin() + at, p.begin() + at + m);
+    for (uint64_t j = 0; j < m; ++j) {
+      p[at + (j + t) % m] = rotate(block[j], (j + t)/m);
+    }
+  }
+
+  // Replaces u0, u1, u2 by u0 + u1 + u2, u0 + omega u1 + omega^2 u2 and
+  // u0 + omega^2 u1 + omega u2.
+  void butterfly(E &u0, E &u1, E &u2) {
+    V sa = add(u1.a, u2.a), sb = add(u1.b, u2.b);
+    V d = sub(u1.b, u2.b), e = sub(u1.a, u2.a);
+    E y0 = {add(u0.a, sa), add(u0.b, sb)};
+    E y1 = {sub(sub(u0.a, d), u2.a), sub(add(u0.b, e), u1.b)};
+    E y2 = {sub(add(u0.a, d), u1.a), sub(sub(u0.b, e), u2.b)};
+    u0 = y0;
+    u1 = y1;
+    u2 = y2;
+  }
+
+  // As fftdif in conv64.cpp, on the r blocks at p[at].
+  void dif(vector<E> &p, uint64_t at, uint64_t m, uint64_t r) {
+    if (r == 1) return;
+    uint64_t rr = r/3;
+    uint64_t pos1 = m*rr, pos2 = 2*m*rr;
+    for (uint64_t i = 0; i < rr; ++i) {
+      for (uint64_t j = 0; j < m; ++j) {
+        uint64_t k = at + i*m + j;
+        butterfly(p[k], p[k + pos1], p[k + pos2]);
+      }
+      twiddle(p, at + pos1 + i*m, m, 3*i*m/r);
+      twiddle(p, at + pos2 + i*m, m, 6*i*m/r);
+    }
+    dif(p, at, m, rr);
+    dif(p, at + pos1, m, rr);
+    dif(p, at + pos2, m, rr);
+  }
+
+  // As fftdit in conv64.cpp, on the r blocks at p[at].
+  void dit(vector<E> &p, uint64_t at, uint64_t m, uint64_t r) {
+    if (r == 1) return;
+    uint64_t rr = r/3;
+    uint64_t pos1 = m*rr, pos2 = 2*m*rr;
+    dit(p, at, m, rr);
+    dit(p, at + pos1, m, rr);
+    dit(p, at + pos2, m, rr);
+    for (uint64_t i = 0; i < rr; ++i) {
+      twiddle(p, at + pos1 + i*m, m, 3*m - 3*i*m/r);
+      twiddle(p, at + pos2 + i*m, m, 3*m - 6*i*m/r);
+      for (uint64_t j = 0; j < m; ++j) {
+        uint64_t k = at + i*m + j;
+        butterfly(p[k], p[k + pos1], p[k + pos2]);
+        swap(p[k + pos1], p[k + pos2]);
+      }
+    }
+  }
+};
+
+int main() {
+  // The shapes of the transforms inside mul for n = 81. Codelets for m = 27
+  // were no faster than the loops, as their 243 elements no longer fit in
+  // registers, and tripled the compile time.
+  vector<pair<uint64_t, uint64_t>> shapes = {{9, 3}, {9, 9}};
+
+  cout << "// Generated by gen_codelets.cpp, do not edit.\n";
+  Generator gen(cout);
+  for (const pair<uint64_t, uint64_t> &s : shapes) {
+    gen.fftdif(s.first, s.second);
+    gen.fftdit(s.first, s.second);
+  }
+
+  for (string name : {"fftdif", "fftdit"}) {
+    cout << "\n// Runs " << name << "(p, m, r) and returns true if there is a "
+         << "codelet for m and r.\n";
+    cout << "inline bool codelet_" << name << "(T *p, uint64_t m, uint64_t r) {\n";
+    for (const pair<uint64_t, uint64_t> &s : shapes) {
+      cout << "  if (m == " << s.first << " && r == " << s.second << ") {\n"
+           << "    " << name << "_" << s.first << "_" << s.second << "(p);\n"
+           << "    return true;\n"
+           << "  }\n";
+    }
+    cout << "  return false;\n}\n";
+  }
+  return 0;
+}